@@ -1,21 +1,34 @@
 #include "CActionsInputRecorder.h"
 
-// Pops recorded keys and converts them into actions via conversion map.
-std::vector<Action::EAction> CActionsInputRecorder::pop_actions() {
-    std::vector<char> recordedInputs = CInputRecorder::pop_recorded_inputs();
-    std::vector<Action::EAction> result;
-    
-    result.reserve(recordedInputs.size());
-    for (const auto& inputAsChar: recordedInputs) {
-        // Push back converted key as action.
-        result.push_back(m_ActionsMap.at(inputAsChar));
+void CActionsInputRecorder::record_input(char input, std::chrono::steady_clock::time_point time) {
+    // Convert the key to its action via conversion table.
+    record_action(m_ActionsMap[key_index(input)], time);
+}
+
+void CActionsInputRecorder::record_action(Action::EAction action, std::chrono::steady_clock::time_point time) {
+    if (action != Action::NO_ACTION) {
+        CRecordedAction recorded{action, time};
+        m_RecordedActions.write(&recorded, 1);
     }
-    return result;
+}
+
+bool CActionsInputRecorder::pop_action(Action::EAction& action, std::chrono::steady_clock::time_point& time) {
+    CRecordedAction recorded;
+    if (m_RecordedActions.read(&recorded, 1) != 1)
+        return false;
+    action = recorded.m_Action;
+    time = recorded.m_Time;
+    return true;
+}
+
+void CActionsInputRecorder::discard_actions() {
+    m_RecordedActions.clear();
 }
 
 CActionsInputRecorder::CActionsInputRecorder(char up, char down, char left, char right, char shoot, char firstGun,
                                              char secondGun, char thirdGun, char fourthGun, char fifthGun,
-                                             char sixthGun, char seventhGun, char eightGun, char ninthGun) {
+                                             char sixthGun, char seventhGun, char eightGun, char ninthGun)
+        : m_RecordedActions(CAPACITY) {
     
     const std::vector<char> inputs = {up, down, left, right, shoot, firstGun,
                                secondGun, thirdGun, fourthGun, fifthGun,
@@ -24,14 +37,14 @@ CActionsInputRecorder::CActionsInputRecorder(char up, char down, char left, char
     // By this method (of putting inputs in a vector and using static_cast) it is easy to
     // add more actions in the future. The actions are tied to be declared in the same order
     // as are chars in %inputs.
+    m_ActionsMap.fill(Action::NO_ACTION);
     for (size_t i = 0; i < inputs.size(); ++i) {
-        m_ActionsMap.insert({inputs[i], static_cast<Action::EAction>(i)});
+        // Detection of multiple actions corresponding to one key.
+        if (m_ActionsMap[key_index(inputs[i])] != Action::NO_ACTION)
+            throw std::invalid_argument("repeated input keys");
+        m_ActionsMap[key_index(inputs[i])] = static_cast<Action::EAction>(i);
     }
     
-    // Detection of multiple actions corresponding to one key.
-    if (m_ActionsMap.size() != Action::EAction::ACTION_COUNT - 1) // '-1' for NONE action
-        throw std::invalid_argument("repeated input keys");
-    
     for (char input : inputs) {
         CInputRecorder::add_recordable_input(input);
     }
@@ -2,12 +2,17 @@
 
 #include "EAction.h"
 #include "CInputRecorder.h"
+#include "CSpscRing.h"
 #include <vector>
+#include <array>
+#include <chrono>
 #include <stdexcept>
-#include <unordered_map>
 
 /// @brief This class extends from CInputRecorder by returning
 /// instances of enum EAction that is then used later by CPlayer.
+/// Keys are converted by a table indexed by the key and the actions are kept in a ring
+/// with a fixed capacity, so nothing is allocated while playing.
+/// Every action keeps the time its key has been read, so the latency of the actions can be measured.
 class CActionsInputRecorder : public CInputRecorder {
 public:
     
@@ -23,9 +28,39 @@ public:
     CActionsInputRecorder(char up, char down, char left, char right, char shoot, char firstGun,
                           char secondGun, char thirdGun, char fourthGun, char fifthGun,
                           char sixthGun, char seventhGun, char eightGun, char ninthGun);
-    /// Returns vector of actions that corresponds to keys entered in constructor.
-    std::vector<Action::EAction> pop_actions();
+    
+    /// Converts a key to its action and records it. Keys without an action are ignored.
+    /// @param[in] input Key that was pressed.
+    /// @param[in] time When the key has been read from the terminal.
+    void record_input(char input, std::chrono::steady_clock::time_point time) override;
+    
+    /// Records an action without a key, used by bots playing instead of a player (see CBot).
+    /// @param[in] action Action to record, NO_ACTION is ignored.
+    /// @param[in] time When the action has been decided.
+    void record_action(Action::EAction action, std::chrono::steady_clock::time_point time);
+    
+    /// Takes the oldest recorded action.
+    /// @param[out] action The action, not changed if there is none.
+    /// @param[out] time When the key of the action has been read, not changed if there is no action.
+    /// @return Whether there was an action.
+    bool pop_action(Action::EAction& action, std::chrono::steady_clock::time_point& time);
+    
+    /// Drops all recorded actions.
+    void discard_actions();
 private:
-    /// Map for converting between inputted keys and actions.
-    std::unordered_map<char, Action::EAction> m_ActionsMap;
+    /// Action together with the time of its key.
+    struct CRecordedAction {
+        
+        /// The recorded action.
+        Action::EAction m_Action;
+        
+        /// When the key of the action has been read.
+        std::chrono::steady_clock::time_point m_Time;
+    };
+    
+    /// Table for converting between inputted keys and actions (NO_ACTION for other keys).
+    std::array<Action::EAction, KEY_COUNT> m_ActionsMap;
+    
+    /// Ring of recorded actions.
+    CSpscRing<CRecordedAction> m_RecordedActions;
 };
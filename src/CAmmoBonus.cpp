@@ -16,7 +16,7 @@ bool CAmmoBonus::during(CPlayer& player) {
 void CAmmoBonus::on_end(CPlayer& player) {}
 
 std::shared_ptr<CBonus> CAmmoBonus::clone() const {
-    return std::make_shared<CAmmoBonus>(*this);
+    return CPoolAllocator<CAmmoBonus>::make_shared(*this);
 }
 
 
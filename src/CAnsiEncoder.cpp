@@ -0,0 +1,153 @@
+#include "CAnsiEncoder.h"
+
+CAnsiEncoder::CAnsiEncoder(int screenColumns)
+        : m_ScreenColumns(screenColumns), m_Column(-1), m_Row(-1), m_Foreground(-1), m_Background(-1) {}
+
+void CAnsiEncoder::invalidate() {
+    m_Column = -1;
+    m_Row = -1;
+    m_Foreground = -1;
+    m_Background = -1;
+}
+
+int CAnsiEncoder::move_cost(int column, int row) const {
+    // Absolute movement - "ESC[row;columnH", the column can be left out if it is the first one.
+    int absolute = column == 0 ? 3 + digits(row + 1) : 4 + digits(row + 1) + digits(column + 1);
+    if (m_Column < 0 || m_Row < 0) {
+        return absolute;
+    }
+    
+    int relative = 0;
+    if (row != m_Row) {
+        relative += relative_move_cost(std::abs(row - m_Row));
+    }
+    if (column != m_Column) {
+        relative += column == 0 ? 1 : relative_move_cost(std::abs(column - m_Column));
+    }
+    return std::min(relative, absolute);
+}
+
+void CAnsiEncoder::move_to(int column, int row, std::ostream& os) {
+    if (column == m_Column && row == m_Row) {
+        return;
+    }
+    
+    int absolute = column == 0 ? 3 + digits(row + 1) : 4 + digits(row + 1) + digits(column + 1);
+    if (move_cost(column, row) < absolute) {
+        // Relative movement is shorter.
+        if (row != m_Row) {
+            write_relative_move(std::abs(row - m_Row), row < m_Row ? 'A' : 'B', os);
+        }
+        if (column == 0 && m_Column != 0) {
+            os.rdbuf()->sputc('\r');
+        } else if (column != m_Column) {
+            write_relative_move(std::abs(column - m_Column), column < m_Column ? 'D' : 'C', os);
+        }
+    } else {
+        char buffer[CTerminal::MAX_SEQUENCE_LENGTH];
+        os.rdbuf()->sputn(buffer, CTerminal::write_move_cursor_to(column, row, buffer) - buffer);
+    }
+    
+    m_Column = column;
+    m_Row = row;
+}
+
+bool CAnsiEncoder::has_colors(Color::EColor foreground, Color::EColor background) const {
+    return m_Foreground == foreground && m_Background == background;
+}
+
+void CAnsiEncoder::set_colors(Color::EColor foreground, Color::EColor background, std::ostream& os) {
+    bool setForeground = m_Foreground != foreground;
+    bool setBackground = m_Background != background;
+    if (!setForeground && !setBackground) {
+        return;
+    }
+    
+    // Both colors fit into one SGR sequence.
+    std::string_view code = setForeground && setBackground ? CTerminal::colors_code(foreground, background)
+                            : setForeground ? CTerminal::color_code(foreground)
+                            : CTerminal::background_color_code(background);
+    os.rdbuf()->sputn(code.data(), static_cast<std::streamsize>(code.size()));
+    
+    m_Foreground = foreground;
+    m_Background = background;
+}
+
+void CAnsiEncoder::write_run(char first, char second, int count, bool mayKeepCursor, std::ostream& os) {
+    int length = 2 * count;
+    if (length <= 0) {
+        return;
+    }
+    
+    // REP - "ESC[nb" repeats the last written character n times.
+    bool canRepeat = first == second && length > 1;
+    int repeatCost = canRepeat ? 4 + digits(length - 1) : length;
+    
+    // ECH - "ESC[nX" erases n characters in the current background color without moving the cursor.
+    if (mayKeepCursor && first == ' ' && second == ' ' && 3 + digits(length) < std::min(length, repeatCost)) {
+        write_command(length, 'X', os);
+        return;
+    }
+    
+    std::streambuf& buffer = *os.rdbuf();
+    if (canRepeat && repeatCost < length) {
+        buffer.sputc(first);
+        write_command(length - 1, 'b', os);
+    } else {
+        for (int i = 0; i < count; ++i) {
+            buffer.sputc(first);
+            buffer.sputc(second);
+        }
+    }
+    advance(length);
+}
+
+int CAnsiEncoder::get_column() const {
+    return m_Column;
+}
+
+int CAnsiEncoder::get_row() const {
+    return m_Row;
+}
+
+int CAnsiEncoder::digits(int value) {
+    int result = 1;
+    while (value >= 10) {
+        value /= 10;
+        ++result;
+    }
+    return result;
+}
+
+int CAnsiEncoder::relative_move_cost(int distance) {
+    // Distance 1 can be left out - "ESC[C".
+    return distance == 1 ? 3 : 3 + digits(distance);
+}
+
+void CAnsiEncoder::write_relative_move(int distance, char command, std::ostream& os) {
+    char buffer[CTerminal::MAX_SEQUENCE_LENGTH];
+    os.rdbuf()->sputn(buffer, CTerminal::write_move_cursor_by(distance, command, buffer) - buffer);
+}
+
+void CAnsiEncoder::write_command(int value, char command, std::ostream& os) {
+    char buffer[CTerminal::MAX_SEQUENCE_LENGTH];
+    char* end = buffer;
+    *end++ = '\033';
+    *end++ = '[';
+    end = CTerminal::write_number(value, end);
+    *end++ = command;
+    os.rdbuf()->sputn(buffer, end - buffer);
+}
+
+void CAnsiEncoder::advance(int count) {
+    if (m_Column < 0) {
+        return;
+    }
+    
+    // Terminals differ in where the cursor is after writing into the last column.
+    m_Column += count;
+    if (m_Column >= m_ScreenColumns) {
+        m_Column = -1;
+        m_Row = -1;
+    }
+}
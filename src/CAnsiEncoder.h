@@ -0,0 +1,105 @@
+#pragma once
+
+#include "EColor.h"
+#include "CTerminal.h"
+#include <ostream>
+#include <algorithm>
+#include <cstdlib>
+
+/// @brief Encoder of ANSI escape sequences that remembers the state of the terminal (cursor position and colors),
+///        so CRenderer only sends what actually changes. It skips SGR sequences setting colors that are
+///        already set, picks the shortest cursor movement (relative, carriage return or absolute CUP)
+///        and encodes runs of identical characters with REP and runs of blank cells with ECH.
+///        Positions are in terminal columns and rows (not in game coordinates).
+///        The sequences are taken from the tables in CTerminal and written directly into the stream buffer
+///        of the output stream, so encoding a frame does not allocate or format anything through the stream.
+class CAnsiEncoder {
+public:
+    
+    /// Constructor of CAnsiEncoder.
+    /// @param[in] screenColumns Number of terminal columns the encoder writes into. When the cursor reaches
+    ///                          the last column, its position is forgotten (terminals differ in how they wrap).
+    explicit CAnsiEncoder(int screenColumns);
+    
+    /// Forgets the state of the terminal. Has to be called when something else has written into the terminal,
+    /// so the next movement is absolute and the next colors are set explicitly.
+    void invalidate();
+    
+    /// @param[in] column Column the cursor should be moved to.
+    /// @param[in] row Row the cursor should be moved to.
+    /// @return Number of bytes 'move_to()' would write.
+    [[nodiscard]] int move_cost(int column, int row) const;
+    
+    /// Moves the cursor using the shortest sequence (nothing if the cursor is already there).
+    /// @param[in] column Column the cursor should be moved to.
+    /// @param[in] row Row the cursor should be moved to.
+    /// @param[in, out] os Stream to write the sequence into.
+    void move_to(int column, int row, std::ostream& os);
+    
+    /// @param[in] foreground Foreground color.
+    /// @param[in] background Background color.
+    /// @return Whether these colors are the colors currently set in the terminal.
+    [[nodiscard]] bool has_colors(Color::EColor foreground, Color::EColor background) const;
+    
+    /// Sets the colors the following characters are written in. Colors that are already set are skipped.
+    /// @param[in] foreground Foreground color.
+    /// @param[in] background Background color.
+    /// @param[in, out] os Stream to write the sequence into.
+    void set_colors(Color::EColor foreground, Color::EColor background, std::ostream& os);
+    
+    /// Writes %count times the same pair of characters at the position of the cursor in the current colors.
+    /// @param[in] first First character of the pair.
+    /// @param[in] second Second character of the pair.
+    /// @param[in] count Number of pairs to write.
+    /// @param[in] mayKeepCursor Whether the cursor may stay at the start of the run. Blank runs
+    ///                          are then erased with ECH instead of being written.
+    /// @param[in, out] os Stream to write into.
+    void write_run(char first, char second, int count, bool mayKeepCursor, std::ostream& os);
+    
+    /// @return Column of the cursor or -1 if it is unknown.
+    [[nodiscard]] int get_column() const;
+    
+    /// @return Row of the cursor or -1 if it is unknown.
+    [[nodiscard]] int get_row() const;
+
+private:
+    
+    /// @param[in] value Non-negative number.
+    /// @return Number of decimal digits of %value.
+    static int digits(int value);
+    
+    /// @param[in] distance Distance to move by (> 0).
+    /// @return Number of bytes of a relative movement by %distance (CUU, CUD, CUF or CUB).
+    static int relative_move_cost(int distance);
+    
+    /// Writes a relative movement (CUU, CUD, CUF or CUB).
+    /// @param[in] distance Distance to move by (> 0).
+    /// @param[in] command Final character of the sequence ('A', 'B', 'C' or 'D').
+    /// @param[in, out] os Stream to write the sequence into.
+    static void write_relative_move(int distance, char command, std::ostream& os);
+    
+    /// Writes a sequence with one numeric parameter (like "ESC[12X").
+    /// @param[in] value Parameter of the sequence.
+    /// @param[in] command Final character of the sequence.
+    /// @param[in, out] os Stream to write the sequence into.
+    static void write_command(int value, char command, std::ostream& os);
+    
+    /// Moves the tracked position of the cursor after writing %count characters.
+    /// @param[in] count Number of written characters.
+    void advance(int count);
+    
+    /// Number of terminal columns the encoder writes into.
+    int m_ScreenColumns;
+    
+    /// Column of the cursor or -1 if it is unknown.
+    int m_Column;
+    
+    /// Row of the cursor or -1 if it is unknown.
+    int m_Row;
+    
+    /// Foreground color currently set in the terminal or -1 if it is unknown.
+    int m_Foreground;
+    
+    /// Background color currently set in the terminal or -1 if it is unknown.
+    int m_Background;
+};
@@ -1,8 +1,8 @@
 #include "CApplication.h"
 
-CApplication::CApplication(const std::string& pathToConfig)
+CApplication::CApplication(const std::string& pathToConfig, std::shared_ptr<CTerminalBackend> backend)
 // Setup config with all variables that necessary to run this application.
-        : m_Config(CConfigRegister::get_config_with_registered_values()) {
+        : m_Config(CConfigRegister::get_config_with_registered_values()), m_Backend(std::move(backend)) {
     
     // Load configuration from a file and check if it was loaded correctly.
     m_Config->load_values(pathToConfig);
@@ -14,13 +14,14 @@ CApplication::CApplication(const std::string& pathToConfig)
 
 void CApplication::run() {
     // Application cannot run correctly if output of the program is not a terminal.
-    if (!CTerminal::is_output_to_terminal()) {
+    if (!m_Backend->is_interactive() || !CTerminal::is_output_to_terminal()) {
         throw std::runtime_error("output of the game is not to a terminal!");
     }
     
     // Main loop of the application
     while (true) {
-        CGame game(m_Config);
+        CGame game(m_Config, m_Backend);
+        game.set_recording(m_RecordingPath);
         
         bool exit;
         std::string level;
@@ -54,6 +55,80 @@ void CApplication::run() {
     }
 }
 
+void CApplication::run_level(const std::string& pathToLevel, size_t tickLimit) {
+    CGame game(m_Config, m_Backend);
+    game.set_tick_limit(tickLimit);
+    game.set_recording(m_RecordingPath);
+    
+    auto startTime = std::chrono::steady_clock::now();
+    bool success;
+    try {
+        success = game.run(pathToLevel);
+    } catch (std::invalid_argument& e) {
+        // Only errors of the config are reported as invalid arguments.
+        throw std::runtime_error("level cannot be loaded (" + std::string(e.what()) + ")");
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    
+    size_t milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
+    std::cout << "Level: " << pathToLevel << std::endl
+              << "Result: " << (success ? "won" : "lost") << " after " << game.get_tick_count() << " ticks ("
+              << milliseconds << " ms)" << std::endl;
+    print_statistics(game);
+}
+
+void CApplication::simulate_level(const std::string& pathToLevel, size_t tickLimit, const std::string& policy) {
+    std::shared_ptr<CBot> bot = CBot::create(policy);
+    if (!bot)
+        throw std::runtime_error("there is no bot policy '" + policy + "'");
+    
+    CGame game(m_Config, m_Backend);
+    game.set_tick_limit(tickLimit);
+    
+    auto startTime = std::chrono::steady_clock::now();
+    bool success;
+    try {
+        success = game.simulate(pathToLevel, *bot);
+    } catch (std::invalid_argument& e) {
+        // Only errors of the config are reported as invalid arguments.
+        throw std::runtime_error("level cannot be loaded (" + std::string(e.what()) + ")");
+    }
+    auto endTime = std::chrono::steady_clock::now();
+    
+    size_t ticks = game.get_tick_count();
+    double seconds = std::chrono::duration<double>(endTime - startTime).count();
+    std::string result = success ? "won" : game.has_player_survived() ? "survived (tick limit reached)" : "lost";
+    std::cout << "Level: " << pathToLevel << std::endl
+              << "Bot: " << policy << std::endl
+              << "Result: " << result << std::endl
+              << "Survival: " << ticks << " ticks" << std::endl
+              << "Speed: " << static_cast<size_t>(seconds > 0 ? ticks / seconds : 0) << " ticks per second ("
+              << std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count() << " us)"
+              << std::endl;
+    game.get_phase_statistics().print(std::cout);
+    std::cout << "Memory pools (high-water marks):" << std::endl;
+    CMemoryPool::print_statistics(std::cout);
+}
+
+void CApplication::set_recording(const std::string& path) {
+    m_RecordingPath = path;
+}
+
+void CApplication::replay(const std::string& pathToRecording, double speed, size_t firstFrame) {
+    CFramePlayer player(pathToRecording);
+    size_t played = player.play(m_Backend, speed, firstFrame, m_Config->m_Char["QUIT"]);
+    
+    std::cout << "Replayed " << played << " of " << player.frame_count() << " frames" << std::endl;
+    m_Backend->print_statistics(std::cout);
+}
+
+void CApplication::print_statistics(const CGame& game) const {
+    std::cout << "Memory pools (high-water marks):" << std::endl;
+    CMemoryPool::print_statistics(std::cout);
+    game.print_statistics(std::cout);
+    m_Backend->print_statistics(std::cout);
+}
+
 void CApplication::register_new_score(const std::string& level, size_t milliseconds) {
     const std::string SCORES_FILE = level + "." + m_Config->m_String["HIGH_SCORES_FILE_EXTENSION"];
     CHighscoresManager highscoresManager;
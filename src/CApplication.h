@@ -4,19 +4,51 @@
 #include "CConfigRegister.h"
 #include "CGame.h"
 #include <filesystem>
+#include "CMemoryPool.h"
+#include "CTerminalBackend.h"
+#include "CFramePlayer.h"
+#include "CBot.h"
 
 /// @brief Class that implements the main program flow.
 class CApplication {
 public:
     /// Constructor of CApplication.
     /// @param pathToConfig Path to file that contains all application parameters.
+    /// @param backend Terminal the levels are played in.
     /// @throws std::invalid_argument When path to config is invalid or the file could not be opened.
-    explicit CApplication(const std::string& pathToConfig);
+    CApplication(const std::string& pathToConfig, std::shared_ptr<CTerminalBackend> backend);
     
     /// Runs application.
-    /// @throw std::runtime_error When unexpected error occurs. For example standard input is closed by eof.
+    /// @throw std::runtime_error When unexpected error occurs. For example standard input is closed by eof
+    ///                           or the backend is not an interactive terminal.
     void run();
     
+    /// Plays one level without the menu and the highscores and prints how it went.
+    /// Works with any backend, so it is used for benchmarks ('make bench').
+    /// @param pathToLevel Path to the level to play.
+    /// @param tickLimit Maximum number of ticks of the game (0 means there is no limit, see CGame::set_tick_limit()).
+    /// @throws std::runtime_error When the level cannot be loaded.
+    void run_level(const std::string& pathToLevel, size_t tickLimit);
+    
+    /// Lets a bot play one level as fast as possible (see CGame::simulate()) and prints the outcome,
+    /// how fast the simulation was and how long the phases of the ticks took.
+    /// @param pathToLevel Path to the level to play.
+    /// @param tickLimit Maximum number of ticks of the game (0 means there is no limit, see CGame::set_tick_limit()).
+    /// @param policy Policy of the bot (see CBot::create()).
+    /// @throws std::runtime_error When the level or the bot cannot be loaded.
+    void simulate_level(const std::string& pathToLevel, size_t tickLimit, const std::string& policy);
+    
+    /// Records the frames of every played level into a file (see CGame::set_recording()).
+    /// @param path Path to the recording (empty string means no recording).
+    void set_recording(const std::string& path);
+    
+    /// Replays a recording made by 'set_recording()' into the backend (see CFramePlayer).
+    /// @param pathToRecording Path to the recording.
+    /// @param speed How many times faster than recorded the frames are replayed (> 0).
+    /// @param firstFrame Index of the first frame to replay.
+    /// @throws std::runtime_error When the recording cannot be loaded.
+    void replay(const std::string& pathToRecording, double speed, size_t firstFrame);
+    
     /// Copying this class is prohibited.
     CApplication(const CApplication& other) = delete;
     
@@ -51,6 +83,12 @@ private:
     /// @param milliseconds Time that player needed for beating the level.
     void register_new_score(const std::string& level, size_t milliseconds);
     
+    /// Method that prints how many objects each memory pool had to hold at most during the last game,
+    /// how long the stages of rendering took and what the backend has found out about the rendering.
+    /// Only benchmark runs print it (see 'run_level()'), interactive games do not.
+    /// @param game Game that has been played.
+    void print_statistics(const CGame& game) const;
+    
     /// Static method that check if the stream has not been closed by eof since this breaks the rest of the application.
     /// @param stream Stream to check.
     /// @throws std::runtime_error Saying that stream has been closed by eof.
@@ -62,4 +100,10 @@ private:
     
     /// Pointer to configuration of this application.
     std::shared_ptr<CConfig> m_Config;
+    
+    /// Terminal the levels are played in.
+    std::shared_ptr<CTerminalBackend> m_Backend;
+    
+    /// Path to the recording of the played levels (empty if they are not recorded).
+    std::string m_RecordingPath;
 };
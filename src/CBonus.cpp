@@ -2,7 +2,7 @@
 
 
 CBonus::CBonus(int probability, CVisualBlock sprite, int durationOfEffect)
-        : m_Probability(probability), m_Sprite(std::move(sprite)), m_DurationOfEffect(durationOfEffect) {}
+        : m_Probability(probability), m_Sprite(CSpritePalette::intern(sprite)), m_DurationOfEffect(durationOfEffect) {}
 
 bool CBonus::has_time_run_out() {
     m_DurationOfEffect--;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CVisualBlock.h"
+#include "CSpritePalette.h"
 #include "CPlayer.h"
 #include <memory>
 #include <utility>
@@ -41,8 +42,8 @@ public:
     /// Number representing percentage of this bonus dropping from an enemy.
     int m_Probability;
     
-    /// Symbol representing the bonus. It is also used when rendering dropped bonuses in game.
-    CVisualBlock m_Sprite;
+    /// Symbol representing the bonus (ID in CSpritePalette). It is also used when rendering dropped bonuses in game.
+    CSpritePalette::SpriteId m_Sprite;
 protected:
     
     /// Internal helper method that checks if the time of effect of the bonus has run out.
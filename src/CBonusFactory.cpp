@@ -33,20 +33,20 @@ std::shared_ptr<CBonus> CBonusFactory::create_heal_bonus(const std::string& bonu
     int healAmount = m_Config->m_Int[bonusName + "_BONUS_HP_AMOUNT"];
     int probability = get_bonus_probability(bonusName);
     CVisualBlock sprite = get_bonus_sprite(bonusName);
-    return std::make_shared<CHealBonus>(probability, sprite, healAmount);
+    return CPoolAllocator<CHealBonus>::make_shared(probability, sprite, healAmount);
 }
 
 std::shared_ptr<CBonus> CBonusFactory::create_double_bullets_bonus(const std::string& bonusName) const {
     int duration = m_Config->m_Int[bonusName + "_BONUS_DURATION"];
     int probability = get_bonus_probability(bonusName);
     CVisualBlock sprite = get_bonus_sprite(bonusName);
-    return std::make_shared<CDoubleBulletsBonus>(probability, sprite, duration);
+    return CPoolAllocator<CDoubleBulletsBonus>::make_shared(probability, sprite, duration);
 }
 
 std::shared_ptr<CBonus> CBonusFactory::create_ammo_bonus(const std::string& bonusName) const {
     int probability = get_bonus_probability(bonusName);
     CVisualBlock sprite = get_bonus_sprite(bonusName);
-    return std::make_shared<CAmmoBonus>(probability, sprite);
+    return CPoolAllocator<CAmmoBonus>::make_shared(probability, sprite);
 }
 
 Toughness::EToughness CBonusFactory::get_bonus_toughness(const std::string& bonusName) const {
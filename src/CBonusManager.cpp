@@ -4,28 +4,21 @@ CBonusManager::CBonusManager(const std::shared_ptr<const CBonusFactory>& factory
         : m_Factory(factory) {}
 
 void CBonusManager::update(CPlayer& player, CMap& bonusMap) {
-    
-    // Update all bonus objects that have been dropped from enemies.
-    for (auto it = m_BonusObjects.begin(); it != m_BonusObjects.end();) {
+    // Dropped bonus objects are kept only in %bonusMap (destroyed ones get erased from it),
+    // so the one the player stands on is looked up directly from its cell.
+    CPosition position = player.get_object()->get_position();
+    std::shared_ptr<CObject> object = bonusMap.object_at(position);
+    if (object != nullptr) {
+        // %bonusMap contains only bonus objects put there by this manager.
+        const auto& bonusObject = static_cast<const CBonusObject&>(*object);
         
-        if ((**it).is_destroyed()) {
-            // If the object got somehow destroyed, we no longer need to store it.
-            it = m_BonusObjects.erase(it);
-            
-        } else if ((**it).get_position() == player.get_object()->get_position()) {
-            // The object is at the same position as player
-            // Move bonus from bonus object into active bonuses.
-            m_Bonuses.emplace_back((**it).m_Bonus);
-            // Call its initial method.
-            m_Bonuses.back()->on_start(player);
-            
-            // Erase the bonus object from the CMap and dropped bonus objects.
-            bonusMap.erase_object(*it);
-            it = m_BonusObjects.erase(it);
-            
-        } else {
-            ++it;
-        }
+        // Move bonus from bonus object into active bonuses.
+        m_Bonuses.emplace_back(bonusObject.m_Bonus);
+        // Call its initial method.
+        m_Bonuses.back()->on_start(player);
+        
+        // Erase the bonus object from the CMap.
+        bonusMap.erase_object_at(position);
     }
     
     // Update all bonuses that are currently effecting the player.
@@ -58,11 +51,8 @@ void CBonusManager::maybe_generate_new_bonus_object(const CPosition& position,
     // std::optional returns false means the object did not get generated (bad luck or the toughness was too low).
     if (!bonus) return;
     
-    // Bonus has been generated -> create its physical form (%bonusObject)
-    // and put it in corresponding containers.
-    auto bonusObject = std::make_shared<CBonusObject>(bonus.value());
-    m_BonusObjects.emplace_back(bonusObject);
-    bonusObjectMap.add_object(m_BonusObjects.back());
+    // Bonus has been generated -> create its physical form and put it into %bonusObjectMap.
+    bonusObjectMap.add_object(CPoolAllocator<CBonusObject>::make_shared(bonus.value()));
 }
 
 
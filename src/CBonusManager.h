@@ -11,6 +11,7 @@
 #include "EToughness.h"
 #include "CBonusFactory.h"
 #include <list>
+#include <algorithm>
 #include <optional>
 
 
@@ -47,9 +48,6 @@ private:
     /// List of all bonuses that are active - currently effecting the player.
     std::list<std::shared_ptr<CBonus>> m_Bonuses;
     
-    // List of bonus objects that are dropped from enemies.
-    std::list<std::shared_ptr<CBonusObject>> m_BonusObjects;
-    
     // Factory for creating a bonuses.
     std::shared_ptr<const CBonusFactory> m_Factory;
 };
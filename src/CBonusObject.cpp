@@ -14,6 +14,6 @@ CBonusObject::CBonusObject(const CBonusObject& other)
         : CObject(other), m_Bonus(other.m_Bonus->clone()) {}
 
 std::shared_ptr<CObject> CBonusObject::clone() const {
-    return std::make_shared<CBonusObject>(*this);
+    return CPoolAllocator<CBonusObject>::make_shared(*this);
 }
 
@@ -0,0 +1,21 @@
+#include "CBot.h"
+#include "CIdleBot.h"
+#include "CRandomBot.h"
+#include "CHunterBot.h"
+#include "CScriptedBot.h"
+
+CBot::~CBot() = default;
+
+std::shared_ptr<CBot> CBot::create(const std::string& policy) {
+    const std::string scriptPrefix = "script:";
+    if (policy == "idle") {
+        return std::make_shared<CIdleBot>();
+    } else if (policy == "random") {
+        return std::make_shared<CRandomBot>();
+    } else if (policy == "hunter") {
+        return std::make_shared<CHunterBot>();
+    } else if (policy.rfind(scriptPrefix, 0) == 0) {
+        return std::make_shared<CScriptedBot>(policy.substr(scriptPrefix.size()));
+    }
+    return nullptr;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CPlayer.h"
+#include "CMap.h"
+#include "CMapJoin.h"
+#include "CActionsInputRecorder.h"
+#include <memory>
+#include <string>
+#include <stdexcept>
+
+/// @brief Abstract class for bots playing a level instead of a player (see CGame::simulate()).
+///        Every tick the bot decides what the player should do and records it into player's controls,
+///        so the player takes it the same way as pressed keys.
+class CBot {
+public:
+    
+    /// Virtual destructor since this is a base class of polymorphic classes.
+    virtual ~CBot();
+    
+    /// Creates a bot by its policy.
+    /// @param[in] policy "idle" (see CIdleBot), "random" (see CRandomBot), "hunter" (see CHunterBot)
+    ///                   or "script:path_to_script" (see CScriptedBot).
+    /// @return New bot or nullptr if there is no such policy.
+    /// @throws std::runtime_error When the script cannot be loaded.
+    [[nodiscard]] static std::shared_ptr<CBot> create(const std::string& policy);
+    
+    /// Decides the action of the player for the next tick and records it into player's controls.
+    /// @param[in] player Player controlled by the bot.
+    /// @param[in] entities Map of the player and the enemies.
+    /// @param[in] environment Map of objects that block the player (walls).
+    /// @param[in, out] controls Controls of the player.
+    virtual void act(const CPlayer& player, const CMap& entities,
+                     const CMapJoin& environment, CActionsInputRecorder& controls) = 0;
+};
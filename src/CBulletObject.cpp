@@ -0,0 +1,66 @@
+#include "CBulletObject.h"
+#include "CBulletStore.h"
+
+CBulletObject::CBulletObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite,
+                             int damage)
+        : CDamagingMovableObject(position, maxHeathPoints, sprite, damage, false),
+          m_Store(nullptr), m_StoreIndex(0) {}
+
+CBulletObject::CBulletObject(const CBulletObject& other)
+        : CDamagingMovableObject(other), m_Store(nullptr), m_StoreIndex(0) {
+    m_Sprite = other.get_plain_sprite_id();
+    if (other.m_Store != nullptr)
+        m_HealthPoints = other.m_Store->health_of(other.m_StoreIndex);
+}
+
+bool CBulletObject::deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects) {
+    if (m_Store == nullptr)
+        return CDamagingMovableObject::deal_damage(damagePoints, hurtObjects);
+    show_as_hurt(hurtObjects);
+    return m_Store->deal_damage(m_StoreIndex, damagePoints);
+}
+
+bool CBulletObject::is_destroyed() const {
+    return m_Store != nullptr ? m_Store->health_of(m_StoreIndex) <= 0 : CDamagingMovableObject::is_destroyed();
+}
+
+CSpritePalette::SpriteId CBulletObject::get_sprite_id() const {
+    CSpritePalette::SpriteId sprite = get_plain_sprite_id();
+    return m_HurtObjects != nullptr ? CSpritePalette::hurt_variant(sprite) : sprite;
+}
+
+CSpritePalette::SpriteId CBulletObject::get_plain_sprite_id() const {
+    return m_Store != nullptr ? m_Store->sprite_of(m_StoreIndex) : m_Sprite;
+}
+
+void CBulletObject::try_to_move(Direction::EDirection move, const CMapJoin& collidableMap,
+                                const CMapJoin& forbiddenMap) {
+    if (m_Store != nullptr) {
+        m_Store->move(m_StoreIndex, move, collidableMap, forbiddenMap);
+        return;
+    }
+    CDamagingMovableObject::try_to_move(move, collidableMap, forbiddenMap);
+}
+
+void CBulletObject::attach(CBulletStore& store, size_t index) {
+    m_Store = &store;
+    m_StoreIndex = index;
+}
+
+void CBulletObject::detach() {
+    m_HealthPoints = m_Store->health_of(m_StoreIndex);
+    m_Sprite = get_plain_sprite_id();
+    m_Store = nullptr;
+}
+
+void CBulletObject::sync_position(const CPosition& position) {
+    m_Position = position;
+}
+
+std::shared_ptr<CObject> CBulletObject::clone() const {
+    return CPoolAllocator<CBulletObject>::make_shared(*this);
+}
+
+std::shared_ptr<CMovableObject> CBulletObject::clone_as_movable() const {
+    return CPoolAllocator<CBulletObject>::make_shared(*this);
+}
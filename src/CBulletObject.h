@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CDamagingMovableObject.h"
+#include <memory>
+#include <cstddef>
+
+class CBulletStore;
+
+/// @brief Class extending CDamagingMovableObject used for representing bullets in the game.
+///        While the bullet is in CBulletStore, its health and sprite live in the arrays of the store
+///        and this object is only a facade - other parts of the game (maps, renderer) reach them through it.
+///        The position is owned by the store as well, but the store writes it back into the object whenever
+///        the bullet moves, so reading the position of any object stays a plain field access.
+///        Until the bullet is added into the store (and after it is erased from it) the object keeps all of it itself.
+class CBulletObject : public CDamagingMovableObject {
+public:
+    
+    /// Constructor of CBulletObject.
+    /// @param[in] position Starting position of the bullet.
+    /// @param[in] maxHeathPoints Maximum health points of the bullet.
+    ///                           Actual health points are set to this number as well.
+    /// @param[in] sprite Looks of the bullet already interned in CSpritePalette.
+    /// @param[in] damage Amount of damage (number of health points) the bullet should deal when colliding with
+    ///                   another object.
+    CBulletObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite, int damage);
+    
+    /// Copy constructor. The copy is not in any store.
+    CBulletObject(const CBulletObject& other);
+    
+    /// The object is referred to by its store, so it cannot be assigned.
+    CBulletObject& operator=(const CBulletObject& other) = delete;
+    
+    /// @return ID of the sprite of the bullet (read from the store if the bullet is in one).
+    [[nodiscard]] CSpritePalette::SpriteId get_sprite_id() const override;
+    
+    /// @return ID of the sprite of the bullet that is not hurt.
+    [[nodiscard]] CSpritePalette::SpriteId get_plain_sprite_id() const;
+    
+    /// Deals damage to the bullet (to its health in the store if the bullet is in one).
+    /// See CObject::deal_damage() for more info.
+    bool deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects) override;
+    
+    /// @return Whether the bullet is destroyed (read from the store if the bullet is in one).
+    [[nodiscard]] bool is_destroyed() const override;
+    
+    /// Moves the bullet. A bullet in a store is moved by the store (see CBulletStore::move()).
+    /// See CDamagingMovableObject::try_to_move() for more info.
+    void try_to_move(Direction::EDirection move, const CMapJoin& collidableMap, const CMapJoin& forbiddenMap) override;
+    
+    /// Makes the object a facade of a bullet in a store. Called by the store.
+    /// @param[in] store Store that holds the bullet.
+    /// @param[in] index Index of the bullet in the arrays of %store.
+    void attach(CBulletStore& store, size_t index);
+    
+    /// Takes the health and the sprite back from the store. Called by the store when it erases the bullet.
+    void detach();
+    
+    /// Writes the position of the bullet in the store into the object. Called by the store when it moves the bullet.
+    /// @param[in] position New position of the bullet.
+    void sync_position(const CPosition& position);
+    
+    /// @return A pointer to a new instance of CBulletObject.
+    [[nodiscard]] std::shared_ptr<CMovableObject> clone_as_movable() const override;
+    
+    /// @return A pointer to a new instance of CBulletObject.
+    [[nodiscard]] std::shared_ptr<CObject> clone() const override;
+
+private:
+    
+    /// Store that holds the bullet (nullptr if the bullet is not in any store).
+    CBulletStore* m_Store;
+    
+    /// Index of the bullet in the arrays of %m_Store.
+    size_t m_StoreIndex;
+};
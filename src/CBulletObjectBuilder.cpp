@@ -11,7 +11,7 @@ CBulletObjectBuilder::CBulletObjectBuilder(int damage, Color::EColor fgColor, Co
           m_UpSymbol(upSymbol),
           m_DownSymbol(downSymbol),
           m_LeftSymbol(leftSymbol),
-          m_RightSymbol(rightSymbol) {}
+          m_RightSymbol(rightSymbol) { intern_sprites(); }
 
 CBulletObjectBuilder::CBulletObjectBuilder(int damage, Color::EColor fgColor, Color::EColor bgColor, int movePeriod,
                                            int healthPoints,
@@ -24,58 +24,59 @@ CBulletObjectBuilder::CBulletObjectBuilder(int damage, Color::EColor fgColor, Co
           m_UpSymbol(symbol),
           m_DownSymbol(symbol),
           m_LeftSymbol(symbol),
-          m_RightSymbol(symbol) {}
+          m_RightSymbol(symbol) { intern_sprites(); }
 
-std::shared_ptr<CMovableObject> CBulletObjectBuilder::build_bullet(
+std::shared_ptr<CBulletObject> CBulletObjectBuilder::build_bullet(
         const CPosition& position, VOrientation::EVOrientation vOrientation,
         HOrientation::EHOrientation hOrientation, bool doubleBullet) const {
     // First we determine the looks of object depending on the orientations in parameters.
     
     // Pick symbol using the orientation.
-    char symbol;
+    int symbolIndex;
     switch (CUtilities::direction_from_vh_orientations(vOrientation, hOrientation)) {
-        case Direction::UP:
-            symbol = m_UpSymbol;
-            break;
         case Direction::DOWN:
-            symbol = m_DownSymbol;
+            symbolIndex = 1;
             break;
         case Direction::LEFT:
-            symbol = m_LeftSymbol;
+            symbolIndex = 2;
             break;
         case Direction::RIGHT:
-            symbol = m_RightSymbol;
+            symbolIndex = 3;
             break;
         default:
-            symbol = m_UpSymbol; // Should not happen.
+            symbolIndex = 0; // Up (or should not happen).
             break;
     }
-    
-    // Sprite of the bullet is two characters.
-    // The first one is determined by previously picked %symbol.
-    // The other one is either blank or the same symbol again, when %doubleBullets == true.
-    char filler = (doubleBullet ? symbol : ' ');
-    std::string content; // The text part of the sprite of the bullet that is going to be shot.
-    if (hOrientation == HOrientation::RIGHT) {
-        content.push_back(filler);
-        content.push_back(symbol);
-    } else {
-        content.push_back(symbol);
-        content.push_back(filler);
-    }
+    CSpritePalette::SpriteId sprite = m_Sprites[symbolIndex][hOrientation == HOrientation::RIGHT][doubleBullet];
     
     // Double bullets deal double damage.
     int damage = m_Damage * (doubleBullet ? 2 : 1);
     
     // Return constructed object.
-    return std::make_shared<CDamagingMovableObject>(
+    return CPoolAllocator<CBulletObject>::make_shared(
             position,
             m_HealthPoints,
-            CVisualBlock(std::move(content), m_FgColor, m_BgColor),
-            damage,
-            false);
+            sprite,
+            damage);
 }
 
 int CBulletObjectBuilder::get_move_period() const {
     return m_MovePeriod;
 }
+
+void CBulletObjectBuilder::intern_sprites() {
+    const char symbols[SYMBOL_COUNT] = {m_UpSymbol, m_DownSymbol, m_LeftSymbol, m_RightSymbol};
+    for (int i = 0; i < SYMBOL_COUNT; ++i) {
+        for (int onRight = 0; onRight < 2; ++onRight) {
+            for (int doubleBullet = 0; doubleBullet < 2; ++doubleBullet) {
+                // Sprite of the bullet is two characters.
+                // The first one is determined by the symbol.
+                // The other one is either blank or the same symbol again, when the bullet is doubled.
+                char filler = (doubleBullet ? symbols[i] : ' ');
+                std::string content = onRight ? std::string{filler, symbols[i]} : std::string{symbols[i], filler};
+                m_Sprites[i][onRight][doubleBullet] = CSpritePalette::intern(CVisualBlock(content, m_FgColor,
+                                                                                          m_BgColor));
+            }
+        }
+    }
+}
@@ -1,9 +1,9 @@
 #pragma once
 
-#include "CDamagingMovableObject.h"
+#include "CBulletObject.h"
 #include <memory>
 
-/// @brief Class that can builds CMovableObject representing the psychical state of the bullet in the game.
+/// @brief Class that can builds CBulletObject representing the psychical state of the bullet in the game.
 ///        Also works as a wrapper since it also stores bullet's move period that is then used to
 ///        determining the speed of the bullet.
 class CBulletObjectBuilder {
@@ -14,7 +14,7 @@ public:
     /// @param[in] fgColor Color of the bullet that this builder creates.
     /// @param[in] bgColor Color of the background behind the bullet that this builder creates.
     /// @param[in] movePeriod For how many ticks the objects stays in the same place when it moves.
-    ///                       See CBullet's attribute m_Ticks for more info.
+    ///                       See CBulletStore for more info.
     /// @param[in] healthPoints Amount of health points the bullet has.
     /// @param[in] upSymbol Char used to display bullet's visuals when shot upwards.
     /// @param[in] downSymbol Char used to display bullet's visuals when shot downwards.
@@ -30,7 +30,7 @@ public:
     /// @param[in] fgColor Color of the bullet that this builder creates.
     /// @param[in] bgColor Color of the background behind the bullet that this builder creates.
     /// @param[in] movePeriod For how many ticks the objects stays in the same place when it moves.
-    ///                       See CBullet's attribute m_Ticks for more info.
+    ///                       See CBulletStore for more info.
     /// @param[in] healthPoints Amount of health points the bullet has.
     /// @param[in] symbol Char used to display bullet's visuals when shot.
     /// @note This class does not use CVisualBlock to store the bullet's looks since every bullet
@@ -46,18 +46,15 @@ public:
     ///                         This is needed so it looks like the entity shot the bullet from the gun it's holding.
     /// @param[in] doubleBullet Whether bullet should be doubled. Visually it means the symbol for the bullet is going
     ///                         to be rendered twice and the bullet is going to deal double damage then normal.
-    [[nodiscard]] std::shared_ptr<CMovableObject> build_bullet(const CPosition& position,
-                                                               VOrientation::EVOrientation vOrientation,
-                                                               HOrientation::EHOrientation hOrientation,
-                                                               bool doubleBullet) const;
+    [[nodiscard]] std::shared_ptr<CBulletObject> build_bullet(const CPosition& position,
+                                                              VOrientation::EVOrientation vOrientation,
+                                                              HOrientation::EHOrientation hOrientation,
+                                                              bool doubleBullet) const;
     
     /// @return Supposed move period - between movements of the bullet this builder creates.
     [[nodiscard]] int get_move_period() const;
 
 private:
-    /// Constructor of CBulletObjectBuilder.
-    /// @param[in] damage The amount of damage the bullet should deal on impact with other object.
-    
     /// The amount of damage the bullet should deal on impact with other object.
     int m_Damage;
     
@@ -71,7 +68,7 @@ private:
     int m_HealthPoints;
     
     /// For how many ticks the objects stays in the same place when it moves.
-    /// See CBullet's attribute m_Ticks for more info.
+    /// See CBulletStore for more info.
     int m_MovePeriod;
     
     /// Char used to display bullet's visuals when shot upwards.
@@ -82,4 +79,15 @@ private:
     char m_LeftSymbol;
     /// Char used to display bullet's visuals when shot to the right.
     char m_RightSymbol;
+    
+    /// Number of symbols of the bullet (up, down, left, right).
+    static constexpr int SYMBOL_COUNT = 4;
+    
+    /// IDs of sprites of all bullets this builder can build. Indexed by [index of the symbol (up, down, left, right)]
+    /// [whether the symbol is on the right side of the sprite][whether the bullet is doubled].
+    CSpritePalette::SpriteId m_Sprites[SYMBOL_COUNT][2][2];
+    
+    /// Interns sprites of all bullets this builder can build into %m_Sprites,
+    /// so building a bullet does not need to create its sprite.
+    void intern_sprites();
 };
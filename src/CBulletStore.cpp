@@ -0,0 +1,133 @@
+#include "CBulletStore.h"
+
+CBulletStore::~CBulletStore() {
+    clear();
+}
+
+void CBulletStore::emplace(const std::shared_ptr<CBulletObject>& object, Direction::EDirection flyingDirection,
+                           int ticksPeriod) {
+    m_Positions.emplace_back(object->get_position());
+    m_Healths.emplace_back(object->get_health());
+    m_Sprites.emplace_back(object->get_plain_sprite_id());
+    m_Damages.emplace_back(object->get_damage());
+    m_FlyingDirections.emplace_back(static_cast<uint8_t>(flyingDirection));
+    // The bullet moves right on its first update (same as CTimeTicks).
+    m_TickCounts.emplace_back(0);
+    m_TickPeriods.emplace_back(ticksPeriod);
+    
+    object->attach(*this, m_Objects.size());
+    m_Objects.emplace_back(object);
+}
+
+void CBulletStore::update(const std::shared_ptr<CMap>& bulletMap, const CMapJoin& environment) {
+    // First pass - advance tick counters of all bullets and decide which of them move.
+    size_t count = m_Objects.size();
+    m_Moves.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        bool move = --m_TickCounts[i] <= 0;
+        if (move)
+            m_TickCounts[i] = m_TickPeriods[i];
+        m_Moves[i] = move ? m_FlyingDirections[i] : static_cast<uint8_t>(Direction::NONE);
+    }
+    
+    // Second pass - move the bullets and erase the destroyed ones.
+    CMapJoin forbiddenMap({bulletMap});
+    for (size_t i = 0; i < m_Objects.size();) {
+        if (m_Healths[i] <= 0) {
+            // Erase it from the CMap if was not done from the outside
+            // (meaning the object was destroyed by external factors, so it got erased automatically).
+            bulletMap->erase_object(m_Objects[i]);
+            // The last bullet gets moved to position %i, so %i is visited again.
+            erase_at(i);
+            continue;
+        }
+        
+        // Move the bullet and update its position in the map.
+        CPosition prevPosition = m_Positions[i];
+        move(i, static_cast<Direction::EDirection>(m_Moves[i]), environment, forbiddenMap);
+        bulletMap->update_position_of_object_at(prevPosition);
+        
+        // A bullet destroyed by the move is erased on the next update.
+        ++i;
+    }
+}
+
+void CBulletStore::move(size_t index, Direction::EDirection move, const CMapJoin& collidableMap,
+                        const CMapJoin& forbiddenMap) {
+    // Bullets have one sprite for all directions, so moving does not change their looks.
+    CPosition newPosition = m_Positions[index] + move;
+    if (CDamagingMovableObject::collide(m_Objects[index].get(), m_Damages[index], m_Positions[index], newPosition,
+                                        collidableMap, forbiddenMap)) {
+        m_Healths[index] = 0;
+        return;
+    }
+    
+    // No collision happened -> move into the new position.
+    if (move != Direction::NONE) {
+        m_Positions[index] = newPosition;
+        m_Objects[index]->sync_position(newPosition);
+    }
+}
+
+bool CBulletStore::deal_damage(size_t index, int damagePoints) {
+    m_Healths[index] -= damagePoints;
+    return m_Healths[index] <= 0;
+}
+
+int CBulletStore::health_of(size_t index) const {
+    return m_Healths[index];
+}
+
+CSpritePalette::SpriteId CBulletStore::sprite_of(size_t index) const {
+    return m_Sprites[index];
+}
+
+size_t CBulletStore::size() const {
+    return m_Objects.size();
+}
+
+bool CBulletStore::empty() const {
+    return m_Objects.empty();
+}
+
+void CBulletStore::clear() {
+    for (const auto& object: m_Objects) {
+        object->detach();
+    }
+    m_Objects.clear();
+    m_Positions.clear();
+    m_Healths.clear();
+    m_FlyingDirections.clear();
+    m_TickCounts.clear();
+    m_TickPeriods.clear();
+    m_Damages.clear();
+    m_Sprites.clear();
+}
+
+void CBulletStore::erase_at(size_t position) {
+    m_Objects[position]->detach();
+    
+    // Move the last bullet into %position (including its move decided for the current update).
+    if (position != m_Objects.size() - 1) {
+        m_Objects[position] = std::move(m_Objects.back());
+        m_Objects[position]->attach(*this, position);
+        m_Positions[position] = m_Positions.back();
+        m_Healths[position] = m_Healths.back();
+        m_FlyingDirections[position] = m_FlyingDirections.back();
+        m_TickCounts[position] = m_TickCounts.back();
+        m_TickPeriods[position] = m_TickPeriods.back();
+        m_Damages[position] = m_Damages.back();
+        m_Sprites[position] = m_Sprites.back();
+        m_Moves[position] = m_Moves.back();
+    }
+    
+    m_Objects.pop_back();
+    m_Positions.pop_back();
+    m_Healths.pop_back();
+    m_FlyingDirections.pop_back();
+    m_TickCounts.pop_back();
+    m_TickPeriods.pop_back();
+    m_Damages.pop_back();
+    m_Sprites.pop_back();
+    m_Moves.pop_back();
+}
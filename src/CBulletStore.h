@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CBulletObject.h"
+#include "CMap.h"
+#include "CMapJoin.h"
+#include "EDirection.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/// @brief Container of all bullets in the game stored as a struct of arrays.
+///        The data touched by every bullet on every tick - position, health, flying direction, tick counter,
+///        move period, damage and sprite - is kept in separate contiguous arrays, so the pass deciding which bullets
+///        move this tick streams only a few bytes per bullet and checking whether a bullet has been destroyed
+///        reads only the arrays. The objects representing the bullets in the game (see CBulletObject) are facades
+///        over the arrays - they are written to only when a bullet moves (its position is written back into its object)
+///        and read only when a bullet collides with something.
+class CBulletStore {
+public:
+    
+    /// Default constructor of CBulletStore.
+    CBulletStore() = default;
+    
+    /// Destructor of CBulletStore. The objects of the bullets take their data back (see CBulletObject::detach()).
+    ~CBulletStore();
+    
+    /// The objects of the bullets refer to the store, so it cannot be copied.
+    CBulletStore(const CBulletStore& other) = delete;
+    
+    /// The objects of the bullets refer to the store, so it cannot be copied.
+    CBulletStore& operator=(const CBulletStore& other) = delete;
+    
+    /// Adds a new bullet into the container. The object becomes a facade of the bullet (see CBulletObject::attach()).
+    /// @param[in] object Object that represents the bullet in the game.
+    /// @param[in] flyingDirection Direction the bullet should move in.
+    /// @param[in] ticksPeriod How often should the bullet move.
+    void emplace(const std::shared_ptr<CBulletObject>& object, Direction::EDirection flyingDirection,
+                 int ticksPeriod);
+    
+    /// Updates all bullets - moves those whose time to move has come and erases destroyed ones.
+    /// @param[in, out] bulletMap CMap that contains objects of the bullets.
+    ///                           The bullets get erased from this CMap if they are destroyed.
+    /// @param[in, out] environment CMap of objects that can interact with the bullets.
+    void update(const std::shared_ptr<CMap>& bulletMap, const CMapJoin& environment);
+    
+    /// Moves a bullet the same way as CDamagingMovableObject::try_to_move(). If it collides with an object,
+    /// the object gets damaged and the bullet gets destroyed.
+    /// @param[in] index Index of the bullet (see CBulletObject::attach()).
+    /// @param[in] move Direction to move into.
+    /// @param[in, out] collidableMap Map of objects the bullet can collide with.
+    /// @param[in, out] forbiddenMap Map of objects the bullet cannot move into (usually the map of the bullets).
+    void move(size_t index, Direction::EDirection move, const CMapJoin& collidableMap, const CMapJoin& forbiddenMap);
+    
+    /// Deals damage to a bullet.
+    /// @param[in] index Index of the bullet (see CBulletObject::attach()).
+    /// @param[in] damagePoints How many health points should be taken.
+    /// @return Whether the bullet was destroyed.
+    bool deal_damage(size_t index, int damagePoints);
+    
+    /// @param[in] index Index of a bullet (see CBulletObject::attach()).
+    /// @return Health points of the bullet.
+    [[nodiscard]] int health_of(size_t index) const;
+    
+    /// @param[in] index Index of a bullet (see CBulletObject::attach()).
+    /// @return ID of the sprite of the bullet.
+    [[nodiscard]] CSpritePalette::SpriteId sprite_of(size_t index) const;
+    
+    /// @return Number of bullets in the container.
+    [[nodiscard]] size_t size() const;
+    
+    /// @return Whether there are no bullets in the container.
+    [[nodiscard]] bool empty() const;
+    
+    /// Erases all bullets from the container.
+    void clear();
+
+private:
+    
+    /// Erases the bullet at %position by moving the last bullet into its place.
+    void erase_at(size_t position);
+    
+    /// Objects that represent the bullets in the game.
+    std::vector<std::shared_ptr<CBulletObject>> m_Objects;
+    
+    /// Position of each bullet.
+    std::vector<CPosition> m_Positions;
+    
+    /// Health points of each bullet (a bullet is destroyed once they drop to zero).
+    std::vector<int> m_Healths;
+    
+    /// Direction each bullet moves in.
+    std::vector<uint8_t> m_FlyingDirections;
+    
+    /// Number of ticks left until each bullet moves.
+    std::vector<int> m_TickCounts;
+    
+    /// How often each bullet moves.
+    std::vector<int> m_TickPeriods;
+    
+    /// Amount of damage each bullet deals when colliding with an object.
+    std::vector<int> m_Damages;
+    
+    /// ID of the sprite of each bullet.
+    std::vector<CSpritePalette::SpriteId> m_Sprites;
+    
+    /// Directions the bullets move in during the current update (Direction::NONE for bullets that wait).
+    std::vector<uint8_t> m_Moves;
+};
@@ -6,7 +6,7 @@ CChargeEnemy::CChargeEnemy(const std::shared_ptr<CMovableObject>& object, const
 
 bool
 CChargeEnemy::inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                           const CMapJoin& environment, std::list<CBullet>& bullets,
+                           const CMapJoin& environment, CBulletStore& bullets,
                            const std::shared_ptr<CMap>& bulletMap) {
     
     // Just get the direction from action.
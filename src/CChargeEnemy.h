@@ -26,11 +26,11 @@ protected:
     ///                                     Necessary for keeping mapping between object and position up to date.
     ///                                     This method also deletes object from this CMap, if it is destroyed.
     /// @param[in, out] environment CMap of objects that can interact with enemy's object.
-    /// @param[out] bullets List of bullets so that shooting enemies can add bullets into the game
+    /// @param[out] bullets Container of bullets so that shooting enemies can add bullets into the game
     ///                     (not relevant to this type of enemy).
     /// @param[out] bulletMap Map containing bullet objects so that shooting enemies can add bullets into the game.
     ///                     (not relevant to this type of enemy).
     bool inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                      const CMapJoin& environment, std::list<CBullet>& bullets,
+                      const CMapJoin& environment, CBulletStore& bullets,
                       const std::shared_ptr<CMap>& bulletMap) override;
 };
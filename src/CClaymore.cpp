@@ -4,29 +4,30 @@
 CClaymore::CClaymore(std::string name, const CBulletObjectBuilder& bulletBuilder, int maxAmmo, int fireRatePeriod,
                      CVisualBlock claymoreSprite, bool infiniteAmmo, bool doubleBullets)
         : CGun(std::move(name), bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, doubleBullets),
-          m_Claymore(nullptr),
+          m_Claymore(),
           m_ClaymoreSprite(std::move(claymoreSprite)), m_Place(true) {}
 
 
-void CClaymore::shoot(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+void CClaymore::shoot(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                       const CPosition& positionOfShooting, const CMapJoin& environment,
                       VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) {
     if (!CGun::can_shoot()) return;
     
     // Check if claymore should be placed or if the stored one is destroyed.
     // If so, place a new one.
-    if (m_Place || m_Claymore == nullptr || m_Claymore->is_destroyed()) {
+    std::shared_ptr<CObject> claymore = bulletMap->get_object(m_Claymore);
+    if (m_Place || claymore == nullptr || claymore->is_destroyed()) {
         Direction::EDirection facingDirection = CUtilities::direction_from_vh_orientations(vOrientation, hOrientation);
         CPosition placement = positionOfShooting + facingDirection;
         
         if (!bulletMap->is_empty_at(placement)) return;
         if (!environment.is_empty_at(placement)) return;
         m_Place = false;
-        m_Claymore = std::make_shared<CObject>(placement,
-                                               1,
-                                               m_ClaymoreSprite,
-                                               true);
-        bulletMap->add_object(m_Claymore);
+        bulletMap->add_object(CPoolAllocator<CObject>::make_shared(placement,
+                                                                   1,
+                                                                   m_ClaymoreSprite,
+                                                                   true));
+        m_Claymore = bulletMap->handle_at(placement);
         decrement_ammo();
         return;
     }
@@ -36,46 +37,48 @@ void CClaymore::shoot(std::list<CBullet>& bullets, const std::shared_ptr<CMap>&
 
 
 std::shared_ptr<CGun> CClaymore::clone() const {
-    return std::make_shared<CClaymore>(*this);
+    return CPoolAllocator<CClaymore>::make_shared(*this);
 }
 
 CClaymore::CClaymore(const CClaymore& other)
-        : CGun(other), m_Claymore(nullptr), m_ClaymoreSprite(other.m_ClaymoreSprite), m_Place(false) {}
+        : CGun(other), m_Claymore(), m_ClaymoreSprite(other.m_ClaymoreSprite), m_Place(false) {}
 
 CClaymore& CClaymore::operator=(const CClaymore& other) {
     if (this == &other) return *this;
     m_Place = false;
     m_ClaymoreSprite = other.m_ClaymoreSprite;
-    m_Claymore = nullptr;
+    m_Claymore = CHandle();
     return *this;
 }
 
-void CClaymore::explode_claymore(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+void CClaymore::explode_claymore(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                                  const CMapJoin& environment) {
-    if (m_Claymore == nullptr) return;
+    std::shared_ptr<CObject> claymore = bulletMap->get_object(m_Claymore);
+    if (claymore == nullptr) return;
     
     // Erase claymore object from map of bullets.
-    bulletMap->erase_object(m_Claymore);
+    bulletMap->erase_object(claymore);
+    m_Claymore = CHandle();
     m_Place = true;
     
     // Shoot in all directions around claymore.
     CGun::spawn_bullet(bullets, bulletMap,
-                       m_Claymore->get_position() + Direction::RIGHT,
+                       claymore->get_position() + Direction::RIGHT,
                        environment,
                        VOrientation::MIDDLE,
                        HOrientation::RIGHT);
     CGun::spawn_bullet(bullets, bulletMap,
-                       m_Claymore->get_position() + Direction::UP,
+                       claymore->get_position() + Direction::UP,
                        environment,
                        VOrientation::UP,
                        HOrientation::RIGHT);
     CGun::spawn_bullet(bullets, bulletMap,
-                       m_Claymore->get_position() + Direction::DOWN,
+                       claymore->get_position() + Direction::DOWN,
                        environment,
                        VOrientation::DOWN,
                        HOrientation::LEFT);
     CGun::spawn_bullet(bullets, bulletMap,
-                       m_Claymore->get_position() + Direction::LEFT,
+                       claymore->get_position() + Direction::LEFT,
                        environment,
                        VOrientation::MIDDLE,
                        HOrientation::LEFT);
@@ -22,12 +22,12 @@ public:
     
     /// If the CClaymore does not have a registered claymore, it will place one.
     /// Otherwise it will make the registered claymore explode.
-    /// @param[in, out] bullets List of bullets in the game so the gun can add a bullet into in.
+    /// @param[in, out] bullets Container of bullets in the game so the gun can add a bullet into in.
     /// @param[in, out] bulletMap CMap containing bullet objects in the game so the gun can add a bullet into in.
     /// @param[in, out] positionOfShooting Position where the entity holding the gun currently is.
     /// @param[in, out] vOrientation VERTICAL orientation of entity holding the gun.
     /// @param[in, out] hOrientation HORIZONTAL orientation of entity holding the gun.
-    void shoot(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+    void shoot(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                const CPosition& positionOfShooting, const CMapJoin& environment,
                VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) override;
     
@@ -43,15 +43,15 @@ public:
 private:
     
     /// Internal method that explodes current claymore at its position.
-    /// @param[out] bullets List of bullets in the game so the gun can add bullets into it.
+    /// @param[out] bullets Container of bullets in the game so the gun can add bullets into it.
     /// @param[out] bulletMap Map of bullet object in the game so the gun can add bullet objects into it.
     /// @param[in, out] environment Map of objects that bullets can interact with.
-    void explode_claymore(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+    void explode_claymore(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                           const CMapJoin& environment);
     
     
-    /// Pointer to a placed claymore.
-    std::shared_ptr<CObject> m_Claymore;
+    /// Handle to a placed claymore in the map of bullets (stale once the claymore is destroyed).
+    CHandle m_Claymore;
     
     /// Visual looks of the placed down claymore.
     CVisualBlock m_ClaymoreSprite;
@@ -22,10 +22,10 @@ CCollidingMovableObject::CCollidingMovableObject(const CPosition& position, int
         position, maxHeathPoints, sprites, canBeSteppedOn) {}
 
 std::shared_ptr<CObject> CCollidingMovableObject::clone() const {
-    return std::make_shared<CCollidingMovableObject>(*this);
+    return CPoolAllocator<CCollidingMovableObject>::make_shared(*this);
 }
 
 std::shared_ptr<CMovableObject> CCollidingMovableObject::clone_as_movable() const {
-    return std::make_shared<CCollidingMovableObject>(*this);
+    return CPoolAllocator<CCollidingMovableObject>::make_shared(*this);
 }
 
@@ -51,6 +51,16 @@ void CConfig::load_values(const std::string& pathToConfig) {
         }
         
     }
+    
+    // Values missing in the file that have a default get it.
+    m_Bool.load_default_values();
+    m_Int.load_default_values();
+    m_Double.load_default_values();
+    m_Char.load_default_values();
+    m_String.load_default_values();
+    m_Color.load_default_values();
+    m_Toughness.load_default_values();
+    m_CVisualBlock.load_default_values();
 }
 
 std::string CConfig::line_error(const std::string& errorMessage, int lineNumber, const std::string& line) {
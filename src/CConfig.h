@@ -1,8 +1,8 @@
 #pragma once
 
-#include "CConfigCategory.h"
 #include "EColor.h"
 #include "EToughness.h"
+#include "CConfigCategory.h"
 #include "CVisualBlock.h"
 #include <fstream>
 #include <sstream>
@@ -32,6 +32,7 @@ public:
     CConfigCategory<CVisualBlock> m_CVisualBlock;
     
     /// Loads all values from the file and throws error if any of them are found.
+    /// Values registered with a default that are not in the file get the default.
     /// @param[in] pathToConfig Path to the configuration file that the values should be loaded from.
     /// @throws std::invalid_argument when the config file could not be opened.
     /// @throws std::invalid_argument if the line in the config line does no have a type specifier.
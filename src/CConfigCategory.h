@@ -44,6 +44,20 @@ public:
     /// @throws std::invalid_argument if the identifier has already been registered.
     void register_value(const std::string& identifier, const CConfigValueValidator<T>& validator, int uniqueId = 0);
     
+    /// Registers value that does not have to be in the configuration file (for example because it has been added
+    /// later and older files do not have it). If it is not loaded, %defaultValue is used (see 'load_default_values()').
+    /// @param[in] identifier String key of the value that we want to register.
+    /// @param[in] validator Validator object that validates the loaded value.
+    /// @param[in] defaultValue Value used when the value is not loaded.
+    /// @throws std::invalid_argument if the identifier has already been registered.
+    void register_value_with_default(const std::string& identifier, const CConfigValueValidator<T>& validator,
+                                     const T& defaultValue);
+    
+    /// Assigns the default values to the identifiers registered with them that have not been loaded.
+    /// Should be called after everything has been loaded from the file.
+    /// @throws std::invalid_argument if a default value is not valid.
+    void load_default_values();
+    
     /// Tries to load the value with identifier %identifier from stream and checks whether it is valid.
     /// @param[in] identifier String key of the value to try to load.
     /// @param[in, out] is Input stream to load the value from.
@@ -125,6 +139,9 @@ private:
     /// Map of identifiers and their values that have been successfully loaded and validated.
     std::unordered_map<std::string, T> m_LoadedValues;
     
+    /// Map of identifiers and the values used when they are not loaded.
+    std::unordered_map<std::string, T> m_DefaultValues;
+    
     /// Map that assigns uniqueId to identifiers.
     std::unordered_map<std::string, int> m_GetUniqueId;
     
@@ -166,6 +183,23 @@ void CConfigCategory<T>::register_value(const std::string& identifier,
     register_unique(identifier, uniqueId);
 }
 
+template<typename T>
+void CConfigCategory<T>::register_value_with_default(const std::string& identifier,
+                                                     const CConfigValueValidator<T>& validator,
+                                                     const T& defaultValue) {
+    register_value(identifier, validator);
+    m_DefaultValues.emplace(identifier, defaultValue);
+}
+
+template<typename T>
+void CConfigCategory<T>::load_default_values() {
+    for (const auto& [identifier, value]: m_DefaultValues) {
+        if (!is_identifier_loaded(identifier)) {
+            validate_and_store(identifier, value);
+        }
+    }
+}
+
 template<typename T>
 const std::unordered_map<std::string, CConfigValueValidator<T>>& CConfigCategory<T>::remaining_identifiers() const {
     return m_ValuesToLoad;
@@ -178,6 +178,8 @@ void CConfigRegister::register_ui(const std::shared_ptr<CConfig>& config, int& u
 void CConfigRegister::register_misc(const std::shared_ptr<CConfig>& config, int& uniqueId) {
     uniqueId++;
     config->m_Int.register_value("MINIMUM_MILLISECONDS_PER_TICK", POSITIVE_INT);
+    // Added later than the other values, so older configuration files do not have it.
+    config->m_Int.register_value_with_default("MAXIMUM_CATCH_UP_TICKS", POSITIVE_INT, 5);
     config->m_String.register_value("PATH_TO_LEVEL_DIRECTORY");
     config->m_String.register_value("LEVEL_FILE_EXTENSION", NON_EMPTY_STRING, uniqueId);
     config->m_String.register_value("HIGH_SCORES_FILE_EXTENSION", NON_EMPTY_STRING, uniqueId);
@@ -0,0 +1,29 @@
+#include "CCountingBackend.h"
+
+CCountingBackend::CCountingBackend()
+        : m_Frames(0), m_Cells(0), m_Bytes(0) {}
+
+void CCountingBackend::record_frame(size_t cells, size_t bytes) {
+    m_Frames++;
+    m_Cells += cells;
+    m_Bytes += bytes;
+}
+
+void CCountingBackend::print_statistics(std::ostream& os) const {
+    os << "Terminal output (counted):" << std::endl
+       << " Frames: " << m_Frames << std::endl
+       << " Cells: " << m_Cells << " (" << (m_Frames == 0 ? 0 : m_Cells / m_Frames) << " per frame)" << std::endl
+       << " Bytes: " << m_Bytes << " (" << (m_Frames == 0 ? 0 : m_Bytes / m_Frames) << " per frame)" << std::endl;
+}
+
+size_t CCountingBackend::get_frames() const {
+    return m_Frames;
+}
+
+size_t CCountingBackend::get_cells() const {
+    return m_Cells;
+}
+
+size_t CCountingBackend::get_bytes() const {
+    return m_Bytes;
+}
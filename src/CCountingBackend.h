@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CNullBackend.h"
+
+/// @brief Backend without any terminal (see CNullBackend) that tallies what would have been sent to one -
+///        the number of frames, encoded cells and bytes. It is what 'make bench' reports.
+class CCountingBackend : public CNullBackend {
+public:
+    
+    /// Default constructor of CCountingBackend.
+    CCountingBackend();
+    
+    /// Adds the cost of a frame to the tallies.
+    /// @param[in] cells Number of cells that had to be encoded.
+    /// @param[in] bytes Number of bytes the frame has been encoded into.
+    void record_frame(size_t cells, size_t bytes) override;
+    
+    /// Prints the tallies.
+    /// @param[in, out] os Stream to print into.
+    void print_statistics(std::ostream& os) const override;
+    
+    /// @return Number of rendered frames.
+    [[nodiscard]] size_t get_frames() const;
+    
+    /// @return Number of encoded cells in all frames.
+    [[nodiscard]] size_t get_cells() const;
+    
+    /// @return Number of bytes of all frames.
+    [[nodiscard]] size_t get_bytes() const;
+
+private:
+    
+    /// Number of rendered frames.
+    size_t m_Frames;
+    
+    /// Number of encoded cells in all frames.
+    size_t m_Cells;
+    
+    /// Number of bytes of all frames.
+    size_t m_Bytes;
+};
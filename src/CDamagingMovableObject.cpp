@@ -5,18 +5,16 @@ CDamagingMovableObject::CDamagingMovableObject(const CPosition& position, int ma
                                                bool canBeSteppedOn)
         : CMovableObject(position, maxHeathPoints, sprite, canBeSteppedOn), m_Damage(damage) {}
 
+CDamagingMovableObject::CDamagingMovableObject(const CPosition& position, int maxHeathPoints,
+                                               CSpritePalette::SpriteId sprite, int damage,
+                                               bool canBeSteppedOn)
+        : CMovableObject(position, maxHeathPoints, sprite, canBeSteppedOn), m_Damage(damage) {}
+
 void CDamagingMovableObject::try_to_move(Direction::EDirection move, const CMapJoin& collidableMap,
                                          const CMapJoin& forbiddenMap) {
     update_sprite(move);
     CPosition newPosition = m_Position + move;
-    
-    // Try dealing damage into positions at newPosition.
-    // We also have to check current position in %collidableMap in case any object stepped on %this.
-    // We do not have to do for %forbiddenMap since no object from %forbiddenMap could step onto
-    // the same place as %this is.
-    if (forbiddenMap.try_dealing_damage_at(m_Damage, newPosition, this) ||
-        collidableMap.try_dealing_damage_at(m_Damage, m_Position, this) ||
-        collidableMap.try_dealing_damage_at(m_Damage, newPosition, this)) {
+    if (collide(this, m_Damage, m_Position, newPosition, collidableMap, forbiddenMap)) {
         destroy_itself();
         return;
     }
@@ -25,6 +23,22 @@ void CDamagingMovableObject::try_to_move(Direction::EDirection move, const CMapJ
     m_Position = newPosition;
 }
 
+int CDamagingMovableObject::get_damage() const {
+    return m_Damage;
+}
+
+bool CDamagingMovableObject::collide(const CObject* object, int damage, const CPosition& position,
+                                     const CPosition& newPosition, const CMapJoin& collidableMap,
+                                     const CMapJoin& forbiddenMap) {
+    // Try dealing damage into positions at newPosition.
+    // We also have to check current position in %collidableMap in case any object stepped on %object.
+    // We do not have to do for %forbiddenMap since no object from %forbiddenMap could step onto
+    // the same place as %object is.
+    return forbiddenMap.try_dealing_damage_at(damage, newPosition, object) ||
+           collidableMap.try_dealing_damage_at(damage, position, object) ||
+           collidableMap.try_dealing_damage_at(damage, newPosition, object);
+}
+
 CDamagingMovableObject::CDamagingMovableObject(const CPosition& position, int maxHeathPoints,
                                                const std::list<CVisualBlock>& sprites,
                                                bool canBeSteppedOn, int damage)
@@ -32,9 +46,9 @@ CDamagingMovableObject::CDamagingMovableObject(const CPosition& position, int ma
           m_Damage(damage) {}
 
 std::shared_ptr<CObject> CDamagingMovableObject::clone() const {
-    return std::make_shared<CDamagingMovableObject>(*this);
+    return CPoolAllocator<CDamagingMovableObject>::make_shared(*this);
 }
 
 std::shared_ptr<CMovableObject> CDamagingMovableObject::clone_as_movable() const {
-    return std::make_shared<CDamagingMovableObject>(*this);
+    return CPoolAllocator<CDamagingMovableObject>::make_shared(*this);
 }
@@ -19,6 +19,17 @@ public:
     CDamagingMovableObject(const CPosition& position, int maxHeathPoints, const CVisualBlock& sprite, int damage,
                            bool canBeSteppedOn);
     
+    /// Constructor of CDamagingMovableObject.
+    /// @param[in] position Starting position of the object.
+    /// @param[in] maxHeathPoints Maximum health points of the object.
+    ///                           Actual health points are set to this number as well.
+    /// @param[in] sprite Looks of the object already interned in CSpritePalette.
+    /// @param[in] damage Amount of damage (number of health points) the object should deal when colliding with
+    ///                   another object.
+    /// @param[in] canBeSteppedOn Whether entities can step on this object or not.
+    CDamagingMovableObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite,
+                           int damage, bool canBeSteppedOn);
+    
     /// Constructor of CDamagingMovableObject.
     /// @param[in] position Starting position of the object.
     /// @param[in] maxHeathPoints Maximum health points of the object.
@@ -53,6 +64,20 @@ public:
     ///                              if there is any object.
     ///                              (usually a CMap containing this movable object).
     void try_to_move(Direction::EDirection move, const CMapJoin& collidableMap, const CMapJoin& forbiddenMap) override;
+    
+    /// @return Amount of damage the object deals when colliding with another object.
+    [[nodiscard]] int get_damage() const;
+    
+    /// Deals damage to the objects a damaging object collides with when moving (see 'try_to_move()').
+    /// @param[in] object The moving object, it does not damage itself.
+    /// @param[in] damage Amount of damage to deal.
+    /// @param[in] position Current position of %object.
+    /// @param[in] newPosition Position %object moves into.
+    /// @param[in, out] collidableMap Map of objects that get damaged at both positions.
+    /// @param[in, out] forbiddenMap Map of objects that get damaged at %newPosition.
+    /// @return Whether any object has been damaged (the moving object should be destroyed then).
+    static bool collide(const CObject* object, int damage, const CPosition& position, const CPosition& newPosition,
+                        const CMapJoin& collidableMap, const CMapJoin& forbiddenMap);
 private:
     
     /// Amount of damage (number of health points) the object should deal when colliding with another object.
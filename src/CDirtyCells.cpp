@@ -0,0 +1,48 @@
+#include "CDirtyCells.h"
+
+CDirtyCells::CDirtyCells()
+        : m_Width(0), m_Height(0), m_WordsPerRow(0), m_AllMarked(false) {}
+
+void CDirtyCells::resize(int width, int height) {
+    m_Width = std::max(width, 0);
+    m_Height = std::max(height, 0);
+    m_WordsPerRow = (m_Width + 63) / 64;
+    m_Bits.assign(static_cast<size_t>(m_WordsPerRow) * m_Height, 0);
+    m_IsRowMarked.assign(m_Height, false);
+    m_MarkedRows.clear();
+    m_AllMarked = false;
+}
+
+void CDirtyCells::mark(const CPosition& position) {
+    if (m_AllMarked || position.m_X < 0 || position.m_X >= m_Width || position.m_Y < 0 || position.m_Y >= m_Height)
+        return;
+    
+    row(position.m_Y)[position.m_X / 64] |= 1ULL << (position.m_X % 64);
+    if (!m_IsRowMarked[position.m_Y]) {
+        m_IsRowMarked[position.m_Y] = true;
+        m_MarkedRows.push_back(position.m_Y);
+    }
+}
+
+void CDirtyCells::mark_all() {
+    clear();
+    m_AllMarked = m_Width > 0 && m_Height > 0;
+}
+
+bool CDirtyCells::empty() const {
+    return !m_AllMarked && m_MarkedRows.empty();
+}
+
+void CDirtyCells::clear() {
+    // Only the marked rows have any bits set.
+    for (int y: m_MarkedRows) {
+        std::fill(row(y), row(y) + m_WordsPerRow, 0);
+        m_IsRowMarked[y] = false;
+    }
+    m_MarkedRows.clear();
+    m_AllMarked = false;
+}
+
+uint64_t* CDirtyCells::row(int y) {
+    return m_Bits.data() + static_cast<size_t>(y) * m_WordsPerRow;
+}
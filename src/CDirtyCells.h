@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CPosition.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/// @brief Set of cells of the level whose looks have changed since the last frame (damaged cells).
+///        Every row has a bitmap of its cells and rows with at least one marked cell are kept in a list,
+///        so marking a cell is a few bit operations and going through the marked cells
+///        costs as much as the number of changed rows rather than the area of the level.
+class CDirtyCells {
+public:
+    
+    /// Default constructor of CDirtyCells. No cell can be marked until 'resize()' gets called.
+    CDirtyCells();
+    
+    /// Sets the size of the level and unmarks all cells.
+    /// @param[in] width Number of cells in a row.
+    /// @param[in] height Number of rows.
+    void resize(int width, int height);
+    
+    /// Marks a cell as changed. Positions outside of the level are ignored.
+    /// @param[in] position Position of the cell.
+    void mark(const CPosition& position);
+    
+    /// Marks all cells of the level as changed (for example when the whole level gets rebuilt).
+    void mark_all();
+    
+    /// @return Whether no cell is marked.
+    [[nodiscard]] bool empty() const;
+    
+    /// Calls %callback for every marked cell, row by row.
+    /// @param[in] callback Called as callback(position) for every marked cell.
+    template<typename Callback>
+    void for_each(Callback callback) const;
+    
+    /// Unmarks all cells.
+    void clear();
+
+private:
+    
+    /// @param[in] y Y coordinate of a row (0 <= %y < %m_Height).
+    /// @return Pointer to the first word of the bitmap of the row.
+    uint64_t* row(int y);
+    
+    /// Number of cells in a row.
+    int m_Width;
+    
+    /// Number of rows.
+    int m_Height;
+    
+    /// Number of words of the bitmap of one row.
+    int m_WordsPerRow;
+    
+    /// Whether all cells are marked (the bitmaps are not used then).
+    bool m_AllMarked;
+    
+    /// Bitmaps of the rows stored one after another.
+    std::vector<uint64_t> m_Bits;
+    
+    /// Y coordinates of the rows with at least one marked cell.
+    std::vector<int> m_MarkedRows;
+    
+    /// Whether a row is in %m_MarkedRows.
+    std::vector<bool> m_IsRowMarked;
+};
+
+template<typename Callback>
+void CDirtyCells::for_each(Callback callback) const {
+    if (m_AllMarked) {
+        for (int y = 0; y < m_Height; ++y) {
+            for (int x = 0; x < m_Width; ++x) {
+                callback(CPosition(x, y));
+            }
+        }
+        return;
+    }
+    
+    for (int y: m_MarkedRows) {
+        const uint64_t* bits = m_Bits.data() + static_cast<size_t>(y) * m_WordsPerRow;
+        for (int word = 0; word < m_WordsPerRow; ++word) {
+            // Walk only the set bits of the word.
+            for (uint64_t remaining = bits[word]; remaining != 0; remaining &= remaining - 1) {
+                callback(CPosition(word * 64 + __builtin_ctzll(remaining), y));
+            }
+        }
+    }
+}
@@ -20,5 +20,5 @@ void CDoubleBulletsBonus::on_end(CPlayer& player) {
 }
 
 std::shared_ptr<CBonus> CDoubleBulletsBonus::clone() const {
-    return std::make_shared<CDoubleBulletsBonus>(*this);
+    return CPoolAllocator<CDoubleBulletsBonus>::make_shared(*this);
 }
@@ -1,11 +1,11 @@
 #include "CDumbFollowerAi.h"
 
 std::shared_ptr<CEnemyAi> CDumbFollowerAi::clone() const {
-    return std::make_shared<CDumbFollowerAi>(*this);
+    return CPoolAllocator<CDumbFollowerAi>::make_shared(*this);
 }
 
 std::shared_ptr<CFollowerAi> CDumbFollowerAi::clone_as_follower() const {
-    return std::make_shared<CDumbFollowerAi>(*this);
+    return CPoolAllocator<CDumbFollowerAi>::make_shared(*this);
 }
 
 Direction::EDirection CDumbFollowerAi::decide_direction(const CPosition& startPosition, const CPosition& targetPosition,
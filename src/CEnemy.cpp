@@ -3,11 +3,11 @@
 CEnemy::CEnemy(const std::shared_ptr<CMovableObject>& object, const CEnemyAi& ai, int tickUpdatePeriod,
                Toughness::EToughness toughness)
         : CNonStaticEntity(object), m_Toughness(toughness), m_Ai(ai.clone()),
-          m_Ticks(tickUpdatePeriod) {}
+          m_TickPeriod(tickUpdatePeriod) {}
 
-bool CEnemy::update(CObject& player, const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
-                    std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap) {
-    if (m_Ticks.decrement()) {
+bool CEnemy::update(bool acts, CObject& player, const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
+                    CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap) {
+    if (acts) {
         Direction::EDirection facingDirection = CUtilities::direction_from_vh_orientations(
                 m_Object->get_v_orientation(), m_Object->get_h_orientation());
         
@@ -21,14 +21,18 @@ bool CEnemy::update(CObject& player, const std::shared_ptr<CMap>& mapContainingO
     }
 }
 
+int CEnemy::get_tick_period() const {
+    return m_TickPeriod;
+}
+
 CEnemy::CEnemy(const CEnemy& other)
         : CNonStaticEntity(other), m_Toughness(other.m_Toughness),
-          m_Ai(other.m_Ai->clone()), m_Ticks(other.m_Ticks) {}
+          m_Ai(other.m_Ai->clone()), m_TickPeriod(other.m_TickPeriod) {}
 
 CEnemy& CEnemy::operator=(const CEnemy& other) {
     if (this == &other) return *this;
     m_Toughness = other.m_Toughness;
     m_Ai = other.m_Ai->clone();
-    m_Ticks = other.m_Ticks;
+    m_TickPeriod = other.m_TickPeriod;
     return *this;
 }
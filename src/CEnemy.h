@@ -1,9 +1,8 @@
 #pragma once
 
 #include "CNonStaticEntity.h"
-#include "CBullet.h"
+#include "CBulletStore.h"
 #include "CEnemyAi.h"
-#include "CTimeTicks.h"
 #include "EToughness.h"
 
 /// @brief Class inheriting from CNonStaticEntity used for management of actions of enemies.
@@ -29,18 +28,22 @@ public:
     /// @return A reference to this.
     CEnemy& operator=(const CEnemy& other);
     
-    /// Updates internal state of the enemy. If it time to do an action (this is determined by %m_Ticks),
+    /// Updates internal state of the enemy. If it is time to do an action (this is determined by CEnemyStore),
     /// the class gets an action from ai and passes it into virtual method 'inner_update()'.
+    /// @param[in] acts Whether the enemy should do an action this tick.
     /// @param player[int, out] Needs player for getting his/her position and potentially dealing damage.
     /// @param[in, out] mapContainingObject CMap that contains object that this enemy controls.
     ///                                     Necessary for keeping mapping between object and position up to date.
     ///                                     This method also deletes object from this CMap, if it is destroyed.
     /// @param[in, out] environment CMap of objects that can interact with enemy's object.
-    /// @param[out] bullets List of bullets so that shooting enemies can add bullets into the game.
+    /// @param[out] bullets Container of bullets so that shooting enemies can add bullets into the game.
     /// @param[out] bulletMap Map containing bullet objects so that shooting enemies can add bullets into the game.
     /// @return Whether enemy should by treated as not destroyed after the update or not (false means destroyed).
-    bool update(CObject& player, const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
-                std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap);
+    bool update(bool acts, CObject& player, const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
+                CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap);
+    
+    /// @return How often should the enemy do an action (move/attack).
+    [[nodiscard]] int get_tick_period() const;
     
     /// Represents how difficult this enemy is to beat.
     /// This is not determined in game but rather in a configuration file.
@@ -52,8 +55,8 @@ protected:
     /// Artificial intelligence of the CEnemy that will determine how the CEnemy behaves.
     std::shared_ptr<CEnemyAi> m_Ai;
     
-    /// Instance of CTimeTicks for determining the time period between enemy doing actions.
-    CTimeTicks m_Ticks;
+    /// How often should the enemy do an action (move/attack). The ticks are counted by CEnemyStore.
+    int m_TickPeriod;
     
     /// Virtual method that is called in children of this class.
     /// @param[in] action Action decided by the ai. Implementation of this method decided how to interpret it.
@@ -62,9 +65,9 @@ protected:
     ///                                     Necessary for keeping mapping between object and position up to date.
     ///                                     This method also deletes object from this CMap, if it is destroyed.
     /// @param[in, out] environment CMap of objects that can interact with enemy's object.
-    /// @param[out] bullets List of bullets so that shooting enemies can add bullets into the game.
+    /// @param[out] bullets Container of bullets so that shooting enemies can add bullets into the game.
     /// @param[out] bulletMap Map containing bullet objects so that shooting enemies can add bullets into the game.
     virtual bool
     inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                 const CMapJoin& environment, std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap) = 0;
+                 const CMapJoin& environment, CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap) = 0;
 };
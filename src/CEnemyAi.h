@@ -3,6 +3,7 @@
 #include "EAction.h"
 #include "EDirection.h"
 #include "CUtilities.h"
+#include "CPoolAllocator.h"
 #include "CMap.h"
 #include "CMapJoin.h"
 #include <memory>
@@ -0,0 +1,37 @@
+#include "CEnemyStore.h"
+
+void CEnemyStore::emplace(const std::shared_ptr<CEnemy>& enemy) {
+    m_Enemies.emplace_back(enemy);
+    // The enemy acts right on its first update (same as CTimeTicks).
+    m_TickCounts.emplace_back(0);
+    m_TickPeriods.emplace_back(enemy->get_tick_period());
+}
+
+size_t CEnemyStore::size() const {
+    return m_Enemies.size();
+}
+
+bool CEnemyStore::empty() const {
+    return m_Enemies.empty();
+}
+
+void CEnemyStore::clear() {
+    m_Enemies.clear();
+    m_TickCounts.clear();
+    m_TickPeriods.clear();
+}
+
+void CEnemyStore::erase_at(size_t position) {
+    // Move the last enemy into %position (including its decision for the current update).
+    if (position != m_Enemies.size() - 1) {
+        m_Enemies[position] = std::move(m_Enemies.back());
+        m_TickCounts[position] = m_TickCounts.back();
+        m_TickPeriods[position] = m_TickPeriods.back();
+        m_Acts[position] = m_Acts.back();
+    }
+    
+    m_Enemies.pop_back();
+    m_TickCounts.pop_back();
+    m_TickPeriods.pop_back();
+    m_Acts.pop_back();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CEnemy.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/// @brief Container of all enemies in the game stored as a struct of arrays.
+///        Tick counters and action periods of the enemies are kept in separate contiguous arrays
+///        (same as in CBulletStore), so the pass deciding which enemies act this tick streams only those
+///        few bytes per enemy. The enemies themselves are reached only when they get updated.
+class CEnemyStore {
+public:
+    
+    /// Adds a new enemy into the container. It acts right on its first update.
+    /// @param[in] enemy Enemy to be added.
+    void emplace(const std::shared_ptr<CEnemy>& enemy);
+    
+    /// Updates all enemies - decides which of them act this tick, calls %updateEnemy on every enemy
+    /// and erases the enemies for which it returns true.
+    /// Every enemy is visited exactly once, even though erasing changes the order of the enemies.
+    /// @param[in] updateEnemy Function taking 'const std::shared_ptr<CEnemy>&' and 'bool' (whether the enemy acts
+    ///                        this tick) and returning whether the enemy was killed and should be erased.
+    template<typename F>
+    void update(F updateEnemy);
+    
+    /// @return Number of enemies in the container.
+    [[nodiscard]] size_t size() const;
+    
+    /// @return Whether there are no enemies in the container.
+    [[nodiscard]] bool empty() const;
+    
+    /// Erases all enemies from the container.
+    void clear();
+
+private:
+    
+    /// Erases the enemy at %position by moving the last enemy into its place.
+    void erase_at(size_t position);
+    
+    /// Enemies in the game.
+    std::vector<std::shared_ptr<CEnemy>> m_Enemies;
+    
+    /// Number of ticks left until each enemy acts.
+    std::vector<int> m_TickCounts;
+    
+    /// How often each enemy acts.
+    std::vector<int> m_TickPeriods;
+    
+    /// Whether each enemy acts during the current update.
+    std::vector<uint8_t> m_Acts;
+};
+
+template<typename F>
+void CEnemyStore::update(F updateEnemy) {
+    // First pass - advance tick counters of all enemies and decide which of them act.
+    size_t count = m_Enemies.size();
+    m_Acts.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        bool acts = --m_TickCounts[i] <= 0;
+        if (acts)
+            m_TickCounts[i] = m_TickPeriods[i];
+        m_Acts[i] = acts;
+    }
+    
+    // Second pass - update the enemies and erase the killed ones.
+    for (size_t i = 0; i < m_Enemies.size();) {
+        // The last enemy gets moved to position %i when erasing, so %i is visited again.
+        if (updateEnemy(m_Enemies[i], m_Acts[i] != 0)) {
+            erase_at(i);
+        } else {
+            ++i;
+        }
+    }
+}
@@ -34,7 +34,7 @@ std::shared_ptr<CObject> CEntityFactory::create_indestructible_wall(const CPosit
 }
 
 std::shared_ptr<CCollidingMovableObject> CEntityFactory::create_player_object(const CPosition& position) const {
-    return std::make_shared<CCollidingMovableObject>(position,
+    return CPoolAllocator<CCollidingMovableObject>::make_shared(position,
                                                      m_Config->m_Int["P_MAX_HEALTH"],
                                                      m_Config->get_sprites_of("P"),
                                                      false);
@@ -71,7 +71,7 @@ CEntityFactory::create_charged_enemy(const CPosition& position, int strength) co
     auto visualBlock = CVisualBlock(stream.str(),
                                     m_Config->m_Color["CHARGED_FG"],
                                     m_Config->m_Color["CHARGED_BG"]);
-    auto object = std::make_shared<CDamagingMovableObject>(position,
+    auto object = CPoolAllocator<CDamagingMovableObject>::make_shared(position,
                                                            strength,
                                                            visualBlock,
                                                            strength,
@@ -79,7 +79,7 @@ CEntityFactory::create_charged_enemy(const CPosition& position, int strength) co
     int updatePeriod = m_Config->m_Int["CHARGED_UPDATE_PERIOD"];
     
     auto& ai = *get_follower_ai_from_level(m_Config->m_Int["CHARGED_AI_LEVEL"]);
-    return std::make_shared<CChargeEnemy>(object, ai, updatePeriod, Toughness::NONE);
+    return CPoolAllocator<CChargeEnemy>::make_shared(object, ai, updatePeriod, Toughness::NONE);
 }
 
 std::shared_ptr<CFollowerAi> CEntityFactory::get_follower_ai_from_level(int level) {
@@ -119,7 +119,7 @@ CEntityFactory::create_melee_enemy(const CPosition& position, const std::string&
     Toughness::EToughness toughness = m_Config->m_Toughness[e + "_TOUGHNESS"];
     int damage = m_Config->m_Int[e + "_DAMAGE"];
     
-    return std::make_shared<CMeleeEnemy>(enemyObject, ai, updatePeriod, toughness, damage);
+    return CPoolAllocator<CMeleeEnemy>::make_shared(enemyObject, ai, updatePeriod, toughness, damage);
 }
 
 std::shared_ptr<CEnemy>
@@ -135,12 +135,12 @@ CEntityFactory::create_ranged_enemy(const CPosition& position, const std::string
     int updatePeriod = m_Config->m_Int[e + "_UPDATE_PERIOD"];
     Toughness::EToughness toughness = m_Config->m_Toughness[e + "_TOUGHNESS"];
     auto gun = create_enemy_pistol(enemyName);
-    return std::make_shared<CRangedEnemy>(enemyObject, ai, updatePeriod, toughness, *gun);
+    return CPoolAllocator<CRangedEnemy>::make_shared(enemyObject, ai, updatePeriod, toughness, *gun);
 }
 
 std::shared_ptr<CCollidingMovableObject>
 CEntityFactory::create_colliding_object(const CPosition& position, const std::string& objectName) const {
-    return std::make_shared<CCollidingMovableObject>(position,
+    return CPoolAllocator<CCollidingMovableObject>::make_shared(position,
                                                      m_Config->m_Int[objectName + "_HEALTH"],
                                                      m_Config->get_sprites_of(objectName),
                                                      false);
@@ -164,7 +164,7 @@ CEntityFactory::create_pistol(const std::string& pistolId, bool infiniteAmmo, bo
         infiniteAmmo = true;
     }
     
-    return std::make_shared<CPistol>(name, bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, false);
+    return CPoolAllocator<CPistol>::make_shared(name, bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, false);
 }
 
 CBulletObjectBuilder CEntityFactory::create_bullet_builder(const std::string& gunId) const {
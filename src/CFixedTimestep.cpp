@@ -0,0 +1,72 @@
+#include "CFixedTimestep.h"
+
+void CFixedTimestep::CStatistics::print(std::ostream& os) const {
+    os << "Game loop (fixed timestep):" << std::endl
+       << " Ticks: " << m_Ticks << " simulated in " << m_Frames << " frames" << std::endl
+       << " Tick overruns: " << m_TickOverruns << std::endl
+       << " Skipped frames: " << m_SkippedFrames << std::endl
+       << " Dropped ticks: " << m_DroppedTicks << std::endl;
+}
+
+CFixedTimestep::CFixedTimestep(Clock::duration tickLength, size_t maxCatchUpTicks)
+        : m_TickLength(std::max(tickLength, Clock::duration::zero())),
+          m_MaxCatchUpTicks(std::max<size_t>(maxCatchUpTicks, 1)),
+          m_Accumulator(Clock::duration::zero()), m_LastTime(Clock::now()) {}
+
+void CFixedTimestep::start() {
+    m_LastTime = Clock::now();
+    
+    // The first tick is simulated right away.
+    m_Accumulator = m_TickLength;
+}
+
+size_t CFixedTimestep::begin_frame() {
+    if (m_TickLength == Clock::duration::zero())
+        return 1;
+    
+    Clock::time_point now = Clock::now();
+    m_Accumulator += now - m_LastTime;
+    m_LastTime = now;
+    
+    // Catch up at most %m_MaxCatchUpTicks ticks, the rest of the time is lost.
+    Clock::duration maxAccumulator = m_TickLength * m_MaxCatchUpTicks;
+    if (m_Accumulator >= maxAccumulator + m_TickLength) {
+        auto dropped = (m_Accumulator - maxAccumulator) / m_TickLength;
+        m_Statistics.m_DroppedTicks += dropped;
+        m_Accumulator -= m_TickLength * dropped;
+    }
+    return m_Accumulator / m_TickLength;
+}
+
+void CFixedTimestep::tick_simulated(Clock::duration simulationTime) {
+    m_Statistics.m_Ticks++;
+    if (m_TickLength == Clock::duration::zero())
+        return;
+    
+    m_Accumulator -= m_TickLength;
+    if (simulationTime > m_TickLength)
+        m_Statistics.m_TickOverruns++;
+}
+
+void CFixedTimestep::end_frame(size_t ticks) {
+    if (ticks > 0) {
+        m_Statistics.m_Frames++;
+        m_Statistics.m_SkippedFrames += ticks - 1;
+    }
+}
+
+CFixedTimestep::Clock::time_point CFixedTimestep::next_tick_time() const {
+    if (m_TickLength == Clock::duration::zero())
+        return Clock::time_point::min();
+    
+    // The next tick is due when the accumulator holds a whole tick again.
+    return m_LastTime + (m_TickLength - std::min(m_Accumulator, m_TickLength));
+}
+
+void CFixedTimestep::reset_statistics() {
+    m_Statistics = CStatistics();
+}
+
+const CFixedTimestep::CStatistics& CFixedTimestep::get_statistics() const {
+    return m_Statistics;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <algorithm>
+#include <cstddef>
+
+/// @brief Clock of the game loop that runs the simulation in ticks of a fixed length.
+///        Time that passes between frames is added to an accumulator and every full tick length in it
+///        is one tick that should be simulated, so the game runs at the same speed (in wall-clock time)
+///        on every machine - periods counted in ticks mean the same time everywhere.
+///        When a frame takes too long, the missing ticks are simulated before the next frame is rendered
+///        (catching up), but at most %m_MaxCatchUpTicks of them. If even that is not enough, the rest
+///        of the time is dropped instead of making every following frame even longer (spiral of death).
+///        With zero tick length the clock is not paced - one tick per frame and no waiting.
+///        The clock does not wait itself, the game loop waits for 'next_tick_time()', so it can react
+///        to other events (like keys or resizes of the terminal) in the meantime.
+class CFixedTimestep {
+public:
+    
+    /// Clock used for measuring the time.
+    typedef std::chrono::steady_clock Clock;
+    
+    /// What happened to the ticks.
+    struct CStatistics {
+        
+        /// Prints the statistics.
+        /// @param[in, out] os Stream to print into.
+        void print(std::ostream& os) const;
+        
+        /// Number of simulated ticks.
+        size_t m_Ticks = 0;
+        
+        /// Number of frames (groups of ticks after which the game was rendered).
+        size_t m_Frames = 0;
+        
+        /// Number of ticks whose simulation took longer than the tick length.
+        size_t m_TickOverruns = 0;
+        
+        /// Number of simulated ticks that were not rendered, because more ticks had to be simulated at once.
+        size_t m_SkippedFrames = 0;
+        
+        /// Number of ticks that were never simulated, because the game could not catch up.
+        size_t m_DroppedTicks = 0;
+    };
+    
+    /// Constructor of CFixedTimestep.
+    /// @param[in] tickLength Length of one tick (zero means the clock is not paced).
+    /// @param[in] maxCatchUpTicks Maximum number of ticks simulated before one frame (at least 1).
+    CFixedTimestep(Clock::duration tickLength, size_t maxCatchUpTicks);
+    
+    /// Starts measuring the time from now with an empty accumulator. Has to be called before the first frame
+    /// and after every pause of the game, so the time the game was paused for is not caught up.
+    void start();
+    
+    /// Adds the time since the last call to the accumulator.
+    /// @return Number of ticks that should be simulated before the next frame (at most %m_MaxCatchUpTicks).
+    size_t begin_frame();
+    
+    /// Takes one tick from the accumulator.
+    /// @param[in] simulationTime How long simulating the tick took.
+    void tick_simulated(Clock::duration simulationTime);
+    
+    /// Finishes a frame in which %ticks ticks have been simulated.
+    /// @param[in] ticks Number of ticks simulated in the frame.
+    void end_frame(size_t ticks);
+    
+    /// @return When the next tick is due. The game loop waits until then (see CTerminalBackend::wait_for_event()).
+    ///         Without pacing the next tick is always due already.
+    [[nodiscard]] Clock::time_point next_tick_time() const;
+    
+    /// Forgets the statistics.
+    void reset_statistics();
+    
+    /// @return What happened to the ticks since the last 'reset_statistics()'.
+    [[nodiscard]] const CStatistics& get_statistics() const;
+
+private:
+    
+    /// Length of one tick.
+    Clock::duration m_TickLength;
+    
+    /// Maximum number of ticks simulated before one frame.
+    size_t m_MaxCatchUpTicks;
+    
+    /// Time that has passed and has not been simulated yet.
+    Clock::duration m_Accumulator;
+    
+    /// When the time was added to the accumulator last.
+    Clock::time_point m_LastTime;
+    
+    /// What happened to the ticks.
+    CStatistics m_Statistics;
+};
@@ -0,0 +1,50 @@
+#include "CFrameBuffer.h"
+
+CFrameBuffer::CFrameBuffer(int width, int height, Cell fillWith)
+        : m_Width(std::max(width, 0)), m_Height(std::max(height, 0)) {
+    // Pad rows to whole cache lines.
+    int wordsPerRow = (m_Width + CELLS_PER_WORD - 1) / CELLS_PER_WORD;
+    int linesPerRow = std::max((wordsPerRow + WORDS_PER_LINE - 1) / WORDS_PER_LINE, 1);
+    m_WordsPerRow = linesPerRow * WORDS_PER_LINE;
+    m_Lines.resize(static_cast<size_t>(linesPerRow) * std::max(m_Height, 1));
+    fill(fillWith);
+}
+
+void CFrameBuffer::fill(Cell cell) {
+    uint64_t word = static_cast<uint64_t>(cell) << 32 | cell;
+    for (CCacheLine& line: m_Lines) {
+        std::fill(std::begin(line.m_Words), std::end(line.m_Words), word);
+    }
+}
+
+void CFrameBuffer::set(int x, int y, Cell cell) {
+    uint64_t& word = row(y)[x / CELLS_PER_WORD];
+    int shift = 32 * (x % CELLS_PER_WORD);
+    word = (word & ~(0xFFFFFFFFull << shift)) | static_cast<uint64_t>(cell) << shift;
+}
+
+CFrameBuffer::Cell CFrameBuffer::get(int x, int y) const {
+    return static_cast<Cell>(row(y)[x / CELLS_PER_WORD] >> (32 * (x % CELLS_PER_WORD)));
+}
+
+int CFrameBuffer::get_width() const {
+    return m_Width;
+}
+
+void CFrameBuffer::copy_row(const CFrameBuffer& other, int y) {
+    std::memcpy(row(y), other.row(y), m_WordsPerRow * sizeof(uint64_t));
+}
+
+int CFrameBuffer::get_height() const {
+    return m_Height;
+}
+
+const uint64_t* CFrameBuffer::row(int y) const {
+    // Cache lines have no padding, so the lines of a row form one array of words.
+    static_assert(sizeof(CCacheLine) == WORDS_PER_LINE * sizeof(uint64_t));
+    return reinterpret_cast<const uint64_t*>(m_Lines.data()) + static_cast<size_t>(y) * m_WordsPerRow;
+}
+
+uint64_t* CFrameBuffer::row(int y) {
+    return reinterpret_cast<uint64_t*>(m_Lines.data()) + static_cast<size_t>(y) * m_WordsPerRow;
+}
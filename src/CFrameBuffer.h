@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CSpritePalette.h"
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Flat buffer of screen cells used by CRenderer.
+///        Every cell is the 32-bit ID of its sprite in CSpritePalette, two neighbouring cells share one 64-bit word.
+///        Rows are padded to whole cache lines, so two frames can be compared a word at a time
+///        and unchanged rows can be skipped with a single 'memcmp'.
+class CFrameBuffer {
+public:
+    
+    /// Sprite shown in a cell.
+    typedef CSpritePalette::SpriteId Cell;
+    
+    /// Constructor of CFrameBuffer.
+    /// @param[in] width Number of cells in a row.
+    /// @param[in] height Number of rows.
+    /// @param[in] fillWith Cell that all cells of the buffer are set to.
+    CFrameBuffer(int width, int height, Cell fillWith);
+    
+    /// Sets all cells of the buffer.
+    /// @param[in] cell Value the cells should be set to.
+    void fill(Cell cell);
+    
+    /// @param[in] x X coordinate (0 <= %x < 'get_width()').
+    /// @param[in] y Y coordinate (0 <= %y < 'get_height()').
+    /// @param[in] cell Value that the cell at [%x, %y] should be set to.
+    void set(int x, int y, Cell cell);
+    
+    /// @param[in] x X coordinate (0 <= %x < 'get_width()').
+    /// @param[in] y Y coordinate (0 <= %y < 'get_height()').
+    /// @return Value of the cell at [%x, %y].
+    [[nodiscard]] Cell get(int x, int y) const;
+    
+    /// Copies one row of another buffer of the same size into this buffer.
+    /// @param[in] other Buffer to copy from.
+    /// @param[in] y Y coordinate of the row (0 <= %y < 'get_height()').
+    void copy_row(const CFrameBuffer& other, int y);
+    
+    /// @return Number of cells in a row.
+    [[nodiscard]] int get_width() const;
+    
+    /// @return Number of rows.
+    [[nodiscard]] int get_height() const;
+    
+    /// Compares this buffer with another buffer of the same size and calls %callback for every
+    /// span of cells that differ. Spans are found two cells at a time, so a span can contain a cell
+    /// that did not change (rendering it again is cheaper than moving the cursor around it).
+    /// @param[in] other Buffer to compare with (usually the previous frame).
+    /// @param[in] callback Called as callback(y, fromX, toX) for every changed span (both ends inclusive).
+    template<typename Callback>
+    void for_each_changed_span(const CFrameBuffer& other, Callback callback) const;
+    
+    /// Same as 'for_each_changed_span()', but compares only the words of one row that contain
+    /// the cells from %fromX to %toX. Used when it is known which part of a row could have changed.
+    /// @param[in] other Buffer to compare with.
+    /// @param[in] y Y coordinate of the row (0 <= %y < 'get_height()').
+    /// @param[in] fromX X coordinate of the first cell that could have changed.
+    /// @param[in] toX X coordinate of the last cell that could have changed.
+    /// @param[in] callback Called as callback(y, fromX, toX) for every changed span (both ends inclusive).
+    template<typename Callback>
+    void for_each_changed_span_in_row(const CFrameBuffer& other, int y, int fromX, int toX, Callback callback) const;
+
+private:
+    
+    /// One cache line worth of words.
+    struct alignas(64) CCacheLine {
+        uint64_t m_Words[8];
+    };
+    
+    /// Number of cells stored in one word.
+    static constexpr int CELLS_PER_WORD = 2;
+    
+    /// Number of words in one cache line.
+    static constexpr int WORDS_PER_LINE = 8;
+    
+    /// @param[in] y Y coordinate of a row (0 <= %y < 'get_height()').
+    /// @return Pointer to the first word of the row.
+    [[nodiscard]] const uint64_t* row(int y) const;
+    
+    /// @param[in] y Y coordinate of a row (0 <= %y < 'get_height()').
+    /// @return Pointer to the first word of the row.
+    uint64_t* row(int y);
+    
+    /// Number of cells in a row.
+    int m_Width;
+    
+    /// Number of rows.
+    int m_Height;
+    
+    /// Number of words in a row including the padding.
+    int m_WordsPerRow;
+    
+    /// Rows stored one after another, each starting at a cache line.
+    std::vector<CCacheLine> m_Lines;
+};
+
+template<typename Callback>
+void CFrameBuffer::for_each_changed_span(const CFrameBuffer& other, Callback callback) const {
+    for (int y = 0; y < m_Height; ++y) {
+        // Most rows do not change at all.
+        if (std::memcmp(row(y), other.row(y), m_WordsPerRow * sizeof(uint64_t)) != 0) {
+            for_each_changed_span_in_row(other, y, 0, m_Width - 1, callback);
+        }
+    }
+}
+
+template<typename Callback>
+void CFrameBuffer::for_each_changed_span_in_row(const CFrameBuffer& other, int y, int fromX, int toX,
+                                                Callback callback) const {
+    const uint64_t* current = row(y);
+    const uint64_t* previous = other.row(y);
+    int lastWord = std::min(toX, m_Width - 1) / CELLS_PER_WORD;
+    
+    int word = std::max(fromX, 0) / CELLS_PER_WORD;
+    while (word <= lastWord) {
+        if (current[word] == previous[word]) {
+            ++word;
+            continue;
+        }
+        
+        // Extend the span over all neighbouring words that differ.
+        int end = word + 1;
+        while (end <= lastWord && current[end] != previous[end]) {
+            ++end;
+        }
+        
+        // Cut off the cells at the ends of the span that are the same.
+        uint64_t firstDifference = current[word] ^ previous[word];
+        uint64_t lastDifference = current[end - 1] ^ previous[end - 1];
+        int spanFrom = word * CELLS_PER_WORD + ((firstDifference & 0xFFFFFFFFu) ? 0 : 1);
+        int spanTo = (end - 1) * CELLS_PER_WORD + ((lastDifference >> 32) ? 1 : 0);
+        if (spanFrom < m_Width) {
+            callback(y, spanFrom, std::min(spanTo, m_Width - 1));
+        }
+        word = end;
+    }
+}
@@ -0,0 +1,104 @@
+#include "CFrameEncoder.h"
+
+CFrameEncoder::CFrameEncoder(int screenWidth, int screenHeight, CSpritePalette::SpriteId background)
+        : m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight), m_Background(background),
+          m_Screen(screenWidth, screenHeight, background),
+          m_Encoder(2 * screenWidth),
+          m_CellsWritten(0), m_InitialRender(true) {}
+
+void CFrameEncoder::begin_frame(std::ostream& os) {
+    // The user interface is rendered into the same stream between frames,
+    // so the cursor and colors have to be set again.
+    m_Encoder.invalidate();
+    
+    if (m_InitialRender) {
+        m_InitialRender = false;
+        do_initial_render(os);
+    }
+}
+
+void CFrameEncoder::render_changes(const CFrameBuffer& frame, std::ostream& os) {
+    frame.for_each_changed_span(m_Screen, [this, &frame, &os](int y, int fromX, int toX) {
+        render_changed_span(frame, y, fromX, toX, os);
+    });
+}
+
+void CFrameEncoder::render_changes_in_row(const CFrameBuffer& frame, int y, int fromX, int toX, std::ostream& os) {
+    frame.for_each_changed_span_in_row(m_Screen, y, fromX, toX, [this, &frame, &os](int row, int spanFrom, int spanTo) {
+        render_changed_span(frame, row, spanFrom, spanTo, os);
+    });
+}
+
+void CFrameEncoder::reset() {
+    // The initial render fills the screen with the background.
+    m_Screen.fill(m_Background);
+    m_InitialRender = true;
+}
+
+CSpritePalette::SpriteId CFrameEncoder::get_background() const {
+    return m_Background;
+}
+
+size_t CFrameEncoder::get_cells_written() const {
+    return m_CellsWritten;
+}
+
+void CFrameEncoder::render_changed_span(const CFrameBuffer& frame, int y, int fromX, int toX, std::ostream& os) {
+    render_span(frame, y, fromX, toX, os);
+    for (int x = fromX; x <= toX; ++x) {
+        m_Screen.set(x, y, frame.get(x, y));
+    }
+}
+
+void CFrameEncoder::render_span(const CFrameBuffer& buffer, int y, int fromX, int toX, std::ostream& os) {
+    // Cells are two columns wide.
+    int cursorColumn = m_Encoder.get_column();
+    if (m_Encoder.get_row() == y && cursorColumn >= 0 && cursorColumn % 2 == 0 && cursorColumn / 2 < fromX) {
+        // The cursor is on the row before the span. Writing the cells in between again (in the same colors)
+        // can be shorter than moving the cursor over them.
+        int gapFrom = cursorColumn / 2;
+        bool sameColors = true;
+        for (int x = gapFrom; x < fromX && sameColors; ++x) {
+            const CVisualBlock& sprite = CSpritePalette::get(buffer.get(x, y));
+            sameColors = m_Encoder.has_colors(sprite.m_ForegroundColor, sprite.m_BackgroundColor);
+        }
+        if (sameColors && 2 * (fromX - gapFrom) <= m_Encoder.move_cost(2 * fromX, y)) {
+            fromX = gapFrom;
+        }
+    }
+    m_Encoder.move_to(2 * fromX, y, os);
+    
+    // Render runs of identical cells at once.
+    int x = fromX;
+    while (x <= toX) {
+        CFrameBuffer::Cell cell = buffer.get(x, y);
+        int runEnd = x + 1;
+        while (runEnd <= toX && buffer.get(runEnd, y) == cell) {
+            ++runEnd;
+        }
+        render_run(cell, runEnd - x, runEnd > toX, os);
+        x = runEnd;
+    }
+}
+
+void CFrameEncoder::render_run(CSpritePalette::SpriteId sprite, int count, bool mayKeepCursor, std::ostream& os) {
+    const CVisualBlock& visualBlock = CSpritePalette::get(sprite);
+    
+    // Sprites are two characters wide, missing characters are rendered as spaces.
+    const std::string& content = visualBlock.m_Content;
+    char first = content.size() > 0 ? content[0] : ' ';
+    char second = content.size() > 1 ? content[1] : ' ';
+    
+    m_Encoder.set_colors(visualBlock.m_ForegroundColor, visualBlock.m_BackgroundColor, os);
+    m_Encoder.write_run(first, second, count, mayKeepCursor, os);
+    m_CellsWritten += count;
+}
+
+void CFrameEncoder::do_initial_render(std::ostream& os) {
+    
+    // Go through all rows and render the default sprite in each of their cells.
+    for (int y = 0; y < m_ScreenHeight; ++y) {
+        m_Encoder.move_to(0, y, os);
+        render_run(m_Background, m_ScreenWidth, true, os);
+    }
+}
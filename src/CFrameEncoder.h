@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CVisualBlock.h"
+#include "CSpritePalette.h"
+#include "CFrameBuffer.h"
+#include "CAnsiEncoder.h"
+#include <ostream>
+#include <string>
+#include <cstddef>
+
+/// @brief Class that stores what the screen currently shows and encodes frames as the differences against it.
+///        Only spans of changed cells are encoded (see CFrameBuffer::for_each_changed_span()) and the escape
+///        sequences are produced by CAnsiEncoder. It does not know anything about the game objects, so frames
+///        can be composed on one thread (see CRenderer) and encoded on another one (see CRenderPipeline).
+class CFrameEncoder {
+public:
+    
+    /// Constructor of CFrameEncoder.
+    /// @param[in] screenWidth Number of cells in a row of the frames.
+    /// @param[in] screenHeight Number of rows of the frames.
+    /// @param[in] background Sprite shown where there is no object, the screen gets filled with it by the initial render.
+    CFrameEncoder(int screenWidth, int screenHeight, CSpritePalette::SpriteId background);
+    
+    /// Prepares encoding of a new frame. Has to be called before the other rendering methods of a frame,
+    /// since something else (like the user interface) could have been rendered into the stream in between.
+    /// Renders the background if this is the first frame or 'reset()' has been called.
+    /// @param[in, out] os Stream to render into.
+    void begin_frame(std::ostream& os);
+    
+    /// Renders all spans of %frame that differ from what the screen shows. Rows that did not change are skipped.
+    /// @param[in] frame Frame that should be shown.
+    /// @param[in, out] os Stream to render into.
+    void render_changes(const CFrameBuffer& frame, std::ostream& os);
+    
+    /// Renders the spans of one row of %frame that differ from what the screen shows.
+    /// Only the cells from %fromX to %toX (and their neighbours sharing a word with them) are compared.
+    /// @param[in] frame Frame that should be shown.
+    /// @param[in] y Y coordinate of the row.
+    /// @param[in] fromX X coordinate of the first cell that could have changed.
+    /// @param[in] toX X coordinate of the last cell that could have changed.
+    /// @param[in, out] os Stream to render into.
+    void render_changes_in_row(const CFrameBuffer& frame, int y, int fromX, int toX, std::ostream& os);
+    
+    /// Forgets what the screen shows, so the next frame gets rendered as a whole.
+    void reset();
+    
+    /// @return ID of the sprite shown where there is no object.
+    [[nodiscard]] CSpritePalette::SpriteId get_background() const;
+    
+    /// @return Number of cells encoded since the encoder has been created (including cells rendered again).
+    [[nodiscard]] size_t get_cells_written() const;
+
+private:
+    
+    /// Renders the changed cells of a span and copies them into %m_Screen.
+    /// @param[in] frame Frame that contains the cells.
+    /// @param[in] y Y coordinate of the row.
+    /// @param[in] fromX X coordinate of the first cell of the span.
+    /// @param[in] toX X coordinate of the last cell of the span.
+    /// @param[in, out] os Stream to render the cells into.
+    void render_changed_span(const CFrameBuffer& frame, int y, int fromX, int toX, std::ostream& os);
+    
+    /// Method for rendering a span of cells in a row.
+    /// Unchanged cells between the cursor and the span are written again if that is
+    /// shorter than moving the cursor, runs of identical cells are written by %m_Encoder at once.
+    /// @param[in] buffer Buffer that contains the cells.
+    /// @param[in] y Y coordinate of the row.
+    /// @param[in] fromX X coordinate of the first cell to render.
+    /// @param[in] toX X coordinate of the last cell to render.
+    /// @param[in, out] os Stream to render the cells into.
+    void render_span(const CFrameBuffer& buffer, int y, int fromX, int toX, std::ostream& os);
+    
+    /// Renders %count cells with the same sprite next to each other at the position of the cursor.
+    /// @param[in] sprite ID of the sprite in CSpritePalette.
+    /// @param[in] count Number of cells.
+    /// @param[in] mayKeepCursor Whether the cursor may stay at the start of the cells (see CAnsiEncoder::write_run()).
+    /// @param[in, out] os Stream to render the cells into.
+    void render_run(CSpritePalette::SpriteId sprite, int count, bool mayKeepCursor, std::ostream& os);
+    
+    /// Renders the background so it does not need to be rendered during
+    /// regular renders.
+    /// @param[in, out] os Stream to render the background into.
+    void do_initial_render(std::ostream& os);
+    
+    /// Number of cells in a row.
+    int m_ScreenWidth;
+    
+    /// Number of rows.
+    int m_ScreenHeight;
+    
+    /// Sprite that is going to be rendered if there is no other object at some location.
+    CSpritePalette::SpriteId m_Background;
+    
+    /// What the screen currently shows.
+    CFrameBuffer m_Screen;
+    
+    /// Encoder of the escape sequences that remembers the cursor position and colors in the terminal.
+    CAnsiEncoder m_Encoder;
+    
+    /// Number of cells encoded since the encoder has been created.
+    size_t m_CellsWritten;
+    
+    /// Whether initial render should happen or not.
+    /// This bool is set to true in the constructor and then
+    /// every time 'reset()' method gets called.
+    bool m_InitialRender;
+};
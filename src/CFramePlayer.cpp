@@ -0,0 +1,192 @@
+#include "CFramePlayer.h"
+
+CFramePlayer::CFramePlayer(const std::string& path)
+        : m_Width(0), m_Height(0), m_Background(0), m_Frame(0, 0, CSpritePalette::NO_SPRITE) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("cannot open recording " + path);
+    }
+    m_Bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    
+    // Header.
+    const std::string magic(CFrameRecorder::MAGIC, sizeof(CFrameRecorder::MAGIC) - 1);
+    if (m_Bytes.size() < magic.size() || !std::equal(magic.begin(), magic.end(), m_Bytes.begin())) {
+        throw std::runtime_error(path + " is not a recording");
+    }
+    size_t offset = magic.size();
+    m_Width = static_cast<int>(read_varint(offset, m_Bytes.size()));
+    m_Height = static_cast<int>(read_varint(offset, m_Bytes.size()));
+    m_Background = read_varint(offset, m_Bytes.size());
+    if (!CUtilities::is_in_range(m_Width, 1, MAX_SIZE) || !CUtilities::is_in_range(m_Height, 1, MAX_SIZE)) {
+        throw std::runtime_error(path + " is not a recording");
+    }
+    
+    // Index the frames and intern the sprites. The last record can be cut off.
+    try {
+        while (offset < m_Bytes.size()) {
+            char type = m_Bytes[offset++];
+            size_t length = read_varint(offset, m_Bytes.size());
+            if (length > m_Bytes.size() - offset)
+                break;
+            if (type == CFrameRecorder::SPRITES_RECORD) {
+                load_sprites(offset, offset + length);
+            } else if (type == CFrameRecorder::KEYFRAME_RECORD || type == CFrameRecorder::DELTA_RECORD) {
+                // Deltas before the first keyframe would have nothing to apply to.
+                if (type == CFrameRecorder::KEYFRAME_RECORD || !m_Frames.empty())
+                    m_Frames.push_back({offset, length, type == CFrameRecorder::KEYFRAME_RECORD});
+            } else {
+                throw std::runtime_error("unknown record");
+            }
+            offset += length;
+        }
+    } catch (std::runtime_error&) {
+        // Play what has been read so far.
+    }
+    
+    if (m_Frames.empty() || m_Background >= m_Sprites.size()) {
+        throw std::runtime_error(path + " does not contain any frame");
+    }
+    m_Frame = CFrameBuffer(m_Width, m_Height, sprite(m_Background));
+}
+
+size_t CFramePlayer::frame_count() const {
+    return m_Frames.size();
+}
+
+size_t CFramePlayer::play(const std::shared_ptr<CTerminalBackend>& backend, double speed, size_t firstFrame, char quitKey) {
+    firstFrame = std::min(firstFrame, m_Frames.size() - 1);
+    
+    // Seek - decode everything from the last keyframe before the first frame.
+    size_t keyframe = firstFrame;
+    while (!m_Frames[keyframe].m_Keyframe) {
+        --keyframe;
+    }
+    for (size_t i = keyframe; i < firstFrame; ++i) {
+        decode_frame(m_Frames[i]);
+    }
+    
+    backend->wait_for_size(m_Width * 2, m_Height);
+    backend->game_mode_on();
+    
+    CFrameEncoder encoder(m_Width, m_Height, sprite(m_Background));
+    COutputBuffer output;
+    std::ostream os(&output);
+    
+    // The only key of a replay is the quit key.
+    auto quitControls = std::make_shared<CInputRecorder>(std::initializer_list<char>{quitKey});
+    CInputManager input(backend, {quitControls});
+    input.start();
+    
+    // Time of the frames is relative to the first replayed one.
+    // A player only waits for the frames if it is interactive.
+    auto frameTime = std::chrono::steady_clock::now();
+    size_t played = 0;
+    for (size_t i = firstFrame; i < m_Frames.size(); ++i, ++played) {
+        uint64_t microseconds = decode_frame(m_Frames[i]);
+        if (backend->is_interactive() && i != firstFrame) {
+            frameTime += std::chrono::microseconds(static_cast<uint64_t>(microseconds / speed));
+        }
+        
+        // Wait for the time of the frame, keys and resizes are handled in the meantime.
+        bool quit = false;
+        do {
+            if (std::chrono::steady_clock::now() < frameTime)
+                backend->wait_for_event(frameTime);
+            input.update();
+            char key;
+            while (quitControls->pop_recorded_input(key)) {
+                quit = true;
+            }
+            if (backend->take_resize()) {
+                backend->wait_for_size(m_Width * 2, m_Height);
+                os << CTerminal::reset_graphics() << CTerminal::erase_entire_screen();
+                encoder.reset();
+            }
+        } while (!quit && std::chrono::steady_clock::now() < frameTime);
+        if (quit)
+            break;
+        
+        size_t cellsBefore = encoder.get_cells_written();
+        encoder.begin_frame(os);
+        encoder.render_changes(m_Frame, os);
+        os.flush();
+        backend->record_frame(encoder.get_cells_written() - cellsBefore, output.size());
+        bool written = backend->write(output.data(), output.size());
+        output.clear();
+        
+        // The terminal is gone, nobody can watch the replay.
+        if (!written)
+            break;
+    }
+    
+    input.stop();
+    backend->reset();
+    return played;
+}
+
+uint64_t CFramePlayer::read_varint(size_t& offset, size_t end) const {
+    uint64_t value = 0;
+    for (int shift = 0; offset < end && shift < 64; shift += 7) {
+        auto byte = static_cast<uint8_t>(m_Bytes[offset++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    throw std::runtime_error("recording is cut off");
+}
+
+void CFramePlayer::load_sprites(size_t offset, size_t end) {
+    uint64_t firstId = read_varint(offset, end);
+    uint64_t count = read_varint(offset, end);
+    if (firstId != m_Sprites.size()) {
+        throw std::runtime_error("sprites are not in order");
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        if (end - offset < 2)
+            throw std::runtime_error("recording is cut off");
+        auto foreground = static_cast<Color::EColor>(static_cast<uint8_t>(m_Bytes[offset++]));
+        auto background = static_cast<Color::EColor>(static_cast<uint8_t>(m_Bytes[offset++]));
+        size_t length = read_varint(offset, end);
+        if (length > end - offset)
+            throw std::runtime_error("recording is cut off");
+        std::string content(m_Bytes.begin() + offset, m_Bytes.begin() + offset + length);
+        offset += length;
+        m_Sprites.push_back(CSpritePalette::intern(CVisualBlock(content, foreground, background)));
+    }
+}
+
+CSpritePalette::SpriteId CFramePlayer::sprite(uint64_t id) const {
+    // Unknown sprites can only be in a damaged recording, they are shown as background.
+    return id < m_Sprites.size() ? m_Sprites[id] : m_Sprites[m_Background];
+}
+
+uint64_t CFramePlayer::decode_frame(const CFrameRecord& record) {
+    size_t offset = record.m_Offset;
+    size_t end = record.m_Offset + record.m_Length;
+    size_t cellCount = static_cast<size_t>(m_Width) * m_Height;
+    uint64_t microseconds = read_varint(offset, end);
+    
+    if (record.m_Keyframe) {
+        size_t cell = 0;
+        while (cell < cellCount && offset < end) {
+            size_t length = std::min<uint64_t>(read_varint(offset, end), cellCount - cell);
+            CSpritePalette::SpriteId id = sprite(read_varint(offset, end));
+            for (size_t runEnd = cell + length; cell < runEnd; ++cell) {
+                m_Frame.set(static_cast<int>(cell % m_Width), static_cast<int>(cell / m_Width), id);
+            }
+        }
+        return microseconds;
+    }
+    
+    uint64_t runCount = read_varint(offset, end);
+    size_t cell = 0;
+    for (uint64_t run = 0; run < runCount; ++run) {
+        cell += read_varint(offset, end);
+        uint64_t length = read_varint(offset, end);
+        for (uint64_t i = 0; i < length && cell < cellCount; ++i, ++cell) {
+            m_Frame.set(static_cast<int>(cell % m_Width), static_cast<int>(cell / m_Width),
+                        sprite(read_varint(offset, end)));
+        }
+    }
+    return microseconds;
+}
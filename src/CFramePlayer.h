@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CFrameRecorder.h"
+#include "CFrameBuffer.h"
+#include "CFrameEncoder.h"
+#include "CSpritePalette.h"
+#include "CTerminalBackend.h"
+#include "CInputManager.h"
+#include "CInputRecorder.h"
+#include "COutputBuffer.h"
+#include "CUtilities.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Class that replays frames recorded by CFrameRecorder into a terminal (see CTerminalBackend).
+///        The whole recording is loaded into memory and indexed, so playback can start at any frame -
+///        the nearest keyframe before it is decoded first and then the deltas up to the frame.
+///        The frames are encoded by CFrameEncoder just like the frames of the game.
+class CFramePlayer {
+public:
+    
+    /// Constructor of CFramePlayer. Loads and indexes a recording and interns its sprites into CSpritePalette.
+    /// A recording cut off in the middle of a record (like when the game crashed) is played up to that record.
+    /// @param[in] path Path to the recording.
+    /// @throws std::runtime_error When the file cannot be read or it is not a recording.
+    explicit CFramePlayer(const std::string& path);
+    
+    /// @return Number of frames in the recording.
+    [[nodiscard]] size_t frame_count() const;
+    
+    /// Replays the recording.
+    /// @param[in, out] backend Terminal to replay into. Frames are timed only if it is interactive,
+    ///                         otherwise they are replayed as fast as possible.
+    /// @param[in] speed How many times faster than recorded the frames are replayed (> 0).
+    /// @param[in] firstFrame Index of the first frame to replay.
+    /// @param[in] quitKey Key that stops the replay.
+    /// @return Number of replayed frames.
+    size_t play(const std::shared_ptr<CTerminalBackend>& backend, double speed, size_t firstFrame, char quitKey);
+
+private:
+    
+    /// Maximum width and height of the frames, anything bigger means the file is not a recording.
+    static constexpr int MAX_SIZE = 4096;
+    
+    /// Position of a frame record in the recording.
+    struct CFrameRecord {
+        
+        /// Index of the payload in %m_Bytes.
+        size_t m_Offset;
+        
+        /// Length of the payload.
+        size_t m_Length;
+        
+        /// Whether it is a keyframe.
+        bool m_Keyframe;
+    };
+    
+    /// Reads an unsigned LEB128 varint.
+    /// @param[in, out] offset Index of the varint in %m_Bytes, moved behind it.
+    /// @param[in] end Index behind the last byte the varint can use.
+    /// @return The number.
+    /// @throws std::runtime_error When the varint does not end before %end.
+    [[nodiscard]] uint64_t read_varint(size_t& offset, size_t end) const;
+    
+    /// Interns sprites of a record into CSpritePalette.
+    /// @param[in] offset Index of the payload in %m_Bytes.
+    /// @param[in] end Index behind the payload.
+    void load_sprites(size_t offset, size_t end);
+    
+    /// @param[in] id ID of a sprite in the recording.
+    /// @return ID of the sprite in CSpritePalette.
+    [[nodiscard]] CSpritePalette::SpriteId sprite(uint64_t id) const;
+    
+    /// Applies a frame record to %m_Frame.
+    /// @param[in] record Frame record.
+    /// @return Microseconds between the frame and the previous one.
+    uint64_t decode_frame(const CFrameRecord& record);
+    
+    /// Content of the recording.
+    std::vector<char> m_Bytes;
+    
+    /// Number of cells in a row of the frames.
+    int m_Width;
+    
+    /// Number of rows of the frames.
+    int m_Height;
+    
+    /// ID of the background sprite in the recording.
+    uint64_t m_Background;
+    
+    /// IDs of the sprites of the recording in CSpritePalette, indexed by their IDs in the recording.
+    std::vector<CSpritePalette::SpriteId> m_Sprites;
+    
+    /// Frame records in the order they were recorded.
+    std::vector<CFrameRecord> m_Frames;
+    
+    /// Frame decoded last.
+    CFrameBuffer m_Frame;
+};
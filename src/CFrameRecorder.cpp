@@ -0,0 +1,131 @@
+#include "CFrameRecorder.h"
+
+CFrameRecorder::CFrameRecorder(const std::string& path, int width, int height, CSpritePalette::SpriteId background,
+                               size_t keyframeInterval)
+        : m_File(path, std::ios::binary | std::ios::trunc), m_Previous(width, height, background),
+          m_KeyframeInterval(std::max<size_t>(keyframeInterval, 1)), m_FramesSinceKeyframe(0),
+          m_RecordedSprites(0), m_PreviousFrameTime(std::chrono::steady_clock::now()),
+          m_RunCount(0), m_NextCell(0) {
+    if (!m_File) {
+        throw std::runtime_error("cannot create recording " + path);
+    }
+    
+    // Force the first frame to be a keyframe.
+    m_FramesSinceKeyframe = m_KeyframeInterval;
+    
+    std::string header(MAGIC, sizeof(MAGIC) - 1);
+    write_varint(width, header);
+    write_varint(height, header);
+    write_varint(background, header);
+    m_File.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+bool CFrameRecorder::is_keyframe_due() const {
+    return m_FramesSinceKeyframe >= m_KeyframeInterval;
+}
+
+void CFrameRecorder::record_keyframe(const CFrameBuffer& frame) {
+    write_new_sprites();
+    write_frame_time();
+    
+    // Runs of identical cells, they can continue over the end of a row.
+    int width = frame.get_width();
+    size_t cellCount = static_cast<size_t>(width) * frame.get_height();
+    size_t runStart = 0;
+    while (runStart < cellCount) {
+        CFrameBuffer::Cell cell = frame.get(runStart % width, runStart / width);
+        size_t runEnd = runStart + 1;
+        while (runEnd < cellCount && frame.get(runEnd % width, runEnd / width) == cell) {
+            ++runEnd;
+        }
+        write_varint(runEnd - runStart, m_Payload);
+        write_varint(cell, m_Payload);
+        runStart = runEnd;
+    }
+    write_record(KEYFRAME_RECORD);
+    
+    m_Previous = frame;
+    m_FramesSinceKeyframe = 1;
+}
+
+void CFrameRecorder::begin_delta_frame() {
+    m_Runs.clear();
+    m_RunCount = 0;
+    m_NextCell = 0;
+}
+
+void CFrameRecorder::record_changes_in_row(const CFrameBuffer& frame, int y, int fromX, int toX) {
+    int width = frame.get_width();
+    int x = std::max(fromX, 0);
+    toX = std::min(toX, width - 1);
+    while (x <= toX) {
+        if (frame.get(x, y) == m_Previous.get(x, y)) {
+            ++x;
+            continue;
+        }
+        
+        // Run of changed cells.
+        int runEnd = x;
+        while (runEnd <= toX && frame.get(runEnd, y) != m_Previous.get(runEnd, y)) {
+            ++runEnd;
+        }
+        size_t cell = static_cast<size_t>(y) * width + x;
+        write_varint(cell - m_NextCell, m_Runs);
+        write_varint(runEnd - x, m_Runs);
+        for (; x < runEnd; ++x) {
+            write_varint(frame.get(x, y), m_Runs);
+            m_Previous.set(x, y, frame.get(x, y));
+        }
+        m_NextCell = static_cast<size_t>(y) * width + runEnd;
+        m_RunCount++;
+    }
+}
+
+void CFrameRecorder::end_delta_frame() {
+    write_new_sprites();
+    write_frame_time();
+    write_varint(m_RunCount, m_Payload);
+    m_Payload += m_Runs;
+    write_record(DELTA_RECORD);
+    m_FramesSinceKeyframe++;
+}
+
+void CFrameRecorder::write_varint(uint64_t value, std::string& bytes) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<char>(value));
+}
+
+void CFrameRecorder::write_new_sprites() {
+    size_t spriteCount = CSpritePalette::size();
+    if (m_RecordedSprites == spriteCount)
+        return;
+    
+    write_varint(m_RecordedSprites, m_Payload);
+    write_varint(spriteCount - m_RecordedSprites, m_Payload);
+    for (; m_RecordedSprites < spriteCount; ++m_RecordedSprites) {
+        const CVisualBlock& sprite = CSpritePalette::get(static_cast<CSpritePalette::SpriteId>(m_RecordedSprites));
+        m_Payload.push_back(static_cast<char>(sprite.m_ForegroundColor));
+        m_Payload.push_back(static_cast<char>(sprite.m_BackgroundColor));
+        write_varint(sprite.m_Content.size(), m_Payload);
+        m_Payload += sprite.m_Content;
+    }
+    write_record(SPRITES_RECORD);
+}
+
+void CFrameRecorder::write_frame_time() {
+    auto now = std::chrono::steady_clock::now();
+    write_varint(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now - m_PreviousFrameTime).count()), m_Payload);
+    m_PreviousFrameTime = now;
+}
+
+void CFrameRecorder::write_record(char type) {
+    std::string prefix(1, type);
+    write_varint(m_Payload.size(), prefix);
+    m_File.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
+    m_File.write(m_Payload.data(), static_cast<std::streamsize>(m_Payload.size()));
+    m_Payload.clear();
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CFrameBuffer.h"
+#include "CSpritePalette.h"
+#include "CVisualBlock.h"
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Class that records composed frames (see CRenderer::start_recording()) into a compact binary file,
+///        which can be replayed later by CFramePlayer.
+///        Most frames are stored as deltas - runs of cells whose sprite IDs changed since the previous frame.
+///        Every %m_KeyframeInterval frames (and whenever the whole frame changed) a keyframe with all cells
+///        is stored instead, so a player can seek without decoding the recording from the start.
+///        Sprites are stored the first time a frame could use them, so IDs in the file mean the same
+///        as in CSpritePalette of the recording game.
+///
+///        All numbers are unsigned LEB128 varints. The file starts with a header:
+///        %MAGIC, width, height, ID of the background sprite. Then records follow, each one is its type
+///        (one byte), the length of its payload and the payload:
+///        - %SPRITES_RECORD: ID of the first sprite, count, then for each sprite: foreground color,
+///          background color, length of the content and the content.
+///        - %KEYFRAME_RECORD: microseconds since the previous frame, then pairs (length, sprite ID)
+///          of runs covering all cells row by row.
+///        - %DELTA_RECORD: microseconds since the previous frame, number of runs, then for each run:
+///          number of unchanged cells since the previous run (row by row), length and the sprite IDs.
+class CFrameRecorder {
+public:
+    
+    /// Number of frames between two keyframes by default (about 5 seconds of the game).
+    static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 250;
+    
+    /// Bytes the file starts with.
+    static constexpr char MAGIC[] = "ZRFRAMES1";
+    
+    /// Type of a record with sprites.
+    static constexpr char SPRITES_RECORD = 'S';
+    
+    /// Type of a record with a keyframe.
+    static constexpr char KEYFRAME_RECORD = 'K';
+    
+    /// Type of a record with a delta frame.
+    static constexpr char DELTA_RECORD = 'D';
+    
+    /// Constructor of CFrameRecorder. Creates the file and writes its header.
+    /// @param[in] path Path to the file to record into (it gets overwritten).
+    /// @param[in] width Number of cells in a row of the frames.
+    /// @param[in] height Number of rows of the frames.
+    /// @param[in] background ID of the sprite shown where there is no object.
+    /// @param[in] keyframeInterval Number of frames between two keyframes.
+    /// @throws std::runtime_error When the file cannot be created.
+    CFrameRecorder(const std::string& path, int width, int height, CSpritePalette::SpriteId background,
+                   size_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+    
+    /// @return Whether the next frame has to be recorded by 'record_keyframe()'.
+    [[nodiscard]] bool is_keyframe_due() const;
+    
+    /// Records all cells of a frame.
+    /// @param[in] frame Frame to record.
+    void record_keyframe(const CFrameBuffer& frame);
+    
+    /// Starts recording a frame as a delta against the previous one.
+    /// Has to be followed by calls of 'record_changes_in_row()' and 'end_delta_frame()'.
+    void begin_delta_frame();
+    
+    /// Records the cells of one row that changed since the previous frame.
+    /// Rows have to be recorded from the top and each one at most once per frame.
+    /// @param[in] frame Frame that is being recorded.
+    /// @param[in] y Y coordinate of the row.
+    /// @param[in] fromX X coordinate of the first cell that could have changed.
+    /// @param[in] toX X coordinate of the last cell that could have changed.
+    void record_changes_in_row(const CFrameBuffer& frame, int y, int fromX, int toX);
+    
+    /// Finishes recording of a delta frame.
+    void end_delta_frame();
+    
+    /// Appends a number as an unsigned LEB128 varint.
+    /// @param[in] value Number to append.
+    /// @param[in, out] bytes Bytes to append to.
+    static void write_varint(uint64_t value, std::string& bytes);
+
+private:
+    
+    /// Writes a record with sprites added to CSpritePalette since the last call.
+    void write_new_sprites();
+    
+    /// Appends the microseconds since the previous frame to %m_Payload.
+    void write_frame_time();
+    
+    /// Writes %m_Payload into the file as a record and clears it.
+    /// @param[in] type Type of the record.
+    void write_record(char type);
+    
+    /// File the frames are recorded into.
+    std::ofstream m_File;
+    
+    /// Last recorded frame.
+    CFrameBuffer m_Previous;
+    
+    /// Number of frames between two keyframes.
+    size_t m_KeyframeInterval;
+    
+    /// Number of frames since the last keyframe.
+    size_t m_FramesSinceKeyframe;
+    
+    /// Number of sprites of CSpritePalette already written into the file.
+    size_t m_RecordedSprites;
+    
+    /// When the previous frame was recorded.
+    std::chrono::steady_clock::time_point m_PreviousFrameTime;
+    
+    /// Payload of the record that is being written. Kept between records, so it does not allocate.
+    std::string m_Payload;
+    
+    /// Runs of the delta frame that is being recorded.
+    std::string m_Runs;
+    
+    /// Number of runs in %m_Runs.
+    size_t m_RunCount;
+    
+    /// Index (row by row) of the cell behind the last recorded run.
+    size_t m_NextCell;
+};
@@ -1,18 +1,30 @@
 #include "CGame.h"
 
-CGame::CGame(const std::shared_ptr<const CConfig>& config)
+void CGame::CPhaseStatistics::print(std::ostream& os) const {
+    os << "Game phases (durations per tick):" << std::endl;
+    m_Input.print_nanoseconds("Input", os);
+    m_Bullets.print_nanoseconds("Bullets", os);
+    m_Entities.print_nanoseconds("Entities", os);
+    m_Bonuses.print_nanoseconds("Bonuses", os);
+    m_Damage.print_nanoseconds("Damage", os);
+    m_Waves.print_nanoseconds("Waves", os);
+}
+
+CGame::CGame(const std::shared_ptr<const CConfig>& config, std::shared_ptr<CTerminalBackend> backend)
 // Game configuration
-        : m_Config(config), m_Factory(std::make_shared<CFactory>(config)),
+        : m_Config(config), m_Backend(std::move(backend)), m_Factory(std::make_shared<CFactory>(config)),
           m_LevelBuilder(m_Config, m_Factory->m_EntityFactory),
           m_BonusManager(m_Factory->m_BonusFactory),
         // Keyboard input
           m_PlayerControls(m_Factory->m_EntityFactory->create_player_controls()),
           m_UiControls(std::make_shared<CInputRecorder>()),
-          m_InputManager({m_PlayerControls, m_UiControls}),
+          m_InputManager(m_Backend, {m_PlayerControls, m_UiControls}),
         // Game's internal variables
-          m_BulletsMap(std::make_shared<CMap>()),
-          m_EntitiesMap(std::make_shared<CMap>()),
-          m_EnvironmentMap(std::make_shared<CMap>()),
+          m_World(std::make_shared<CWorldMap>()),
+          m_BulletsMap(std::make_shared<CMap>(m_World, Layer::BULLET)),
+          m_EntitiesMap(std::make_shared<CMap>(m_World, Layer::ENTITY)),
+          m_EnvironmentMap(std::make_shared<CMap>(m_World, Layer::ENVIRONMENT)),
+          m_BonusMap(std::make_shared<CMap>(m_World, Layer::BONUS)),
         // User Interface
           m_HealthDisplay(
                   config->m_Int["HEALTH_MAX_LENGTH"],
@@ -25,7 +37,14 @@ CGame::CGame(const std::shared_ptr<const CConfig>& config)
           m_CurrentGunDisplay(
                   config->m_Int["GUN_MAX_LENGTH"],
                   config->m_String["GUN_TEXT"],
-                  config->m_Color["GUN_COLOR"]) {
+                  config->m_Color["GUN_COLOR"]),
+        // Output
+          m_ResetCount(0), m_TickLimit(0),
+        // Game loop, without a player the game runs as fast as it can.
+          m_Timestep(m_Backend->is_interactive()
+                     ? std::chrono::milliseconds(config->m_Int["MINIMUM_MILLISECONDS_PER_TICK"])
+                     : CFixedTimestep::Clock::duration::zero(),
+                     config->m_Int["MAXIMUM_CATCH_UP_TICKS"]) {
     
     m_UiControls->add_recordable_input(config->m_Char["PAUSE"]);
     m_UiControls->add_recordable_input(config->m_Char["QUIT"]);
@@ -33,6 +52,23 @@ CGame::CGame(const std::shared_ptr<const CConfig>& config)
 }
 
 void CGame::setup(const std::string& pathToLevel) {
+    load(pathToLevel);
+    
+    // Wait for correct size of the terminal depending on the width and height of the level.
+    m_Backend->wait_for_size(levelDimensions.m_X * 2,
+                             levelDimensions.m_Y + 5);
+    
+    // Clear screen, turn of echo and blocking input.
+    m_Backend->game_mode_on();
+    
+    // Place the UI, it gets rendered with the first frame.
+    setup_interface();
+}
+
+void CGame::load(const std::string& pathToLevel) {
+    // Objects hurt in a previous game in this world are not shown as hurt anymore.
+    m_World->get_hurt_objects().clear();
+    
     // Load level from file
     CPosition playerStartingPosition;
     m_LevelBuilder.load_level(pathToLevel,
@@ -41,9 +77,8 @@ void CGame::setup(const std::string& pathToLevel) {
                               playerStartingPosition,
                               levelDimensions);
     
-    // Wait for correct size of the terminal depending on the width and height of the level.
-    CTerminal::wait_for_terminal_size(levelDimensions.m_X * 2,
-                                      levelDimensions.m_Y + 5);
+    // Now that the size of the level is known, the world can store its objects in a grid.
+    m_World->set_dimensions(levelDimensions.m_X, levelDimensions.m_Y);
     
     // Create player object and add it into the game.
     m_Player = m_Factory->m_EntityFactory->create_player(playerStartingPosition, m_PlayerControls);
@@ -51,66 +86,147 @@ void CGame::setup(const std::string& pathToLevel) {
     for (auto& gun: m_Factory->m_EntityFactory->create_all_available_guns()) {
         m_Player.add_gun(*gun);
     }
-    
-    // Clear screen, turn of echo and blocking input.
-    CTerminal::game_mode_on();
-    
-    // Initial render of UI.
-    setup_interface();
 }
 
 bool CGame::run(const std::string& pathToLevel) {
+    // Pool statistics reported at the end of the game should only cover this level.
+    CMemoryPool::reset_high_water_marks();
+    
     // Load level from file.
     setup(pathToLevel);
     
-    // Create renderer responsible for displaying the state of the game.
+    // Keys are read by a thread of their own from now on, so they are not delayed until the next tick.
+    m_InputManager.start();
+    
+    // Create renderer responsible for composing the frames and pipeline that displays them on other threads.
     CRenderer renderer(levelDimensions.m_X, levelDimensions.m_Y, *m_Config);
-    reset_rendering(renderer); // Initial render of the game.
+    if (!m_RecordingPath.empty()) {
+        renderer.start_recording(std::make_shared<CFrameRecorder>(m_RecordingPath, levelDimensions.m_X,
+                                                                  levelDimensions.m_Y, renderer.get_background()));
+    }
+    std::cout << std::flush;
+    CRenderPipeline pipeline(
+            CRenderPipeline::CSnapshot(CFrameBuffer(levelDimensions.m_X, levelDimensions.m_Y, renderer.get_background())),
+            renderer.get_background(),
+            [this](const CRenderPipeline::CSnapshot& snapshot, bool afterReset, std::ostream& os) {
+                render_interface(snapshot, afterReset, os);
+            },
+            *m_Backend);
+    reset_rendering(); // Initial render of the game.
     bool exit = false;
     bool success = false;
     
-    // Length of time the game should pause for, so it is not too fast on faster computers.
-    int sleepFor = m_Config->m_Int["MINIMUM_MILLISECONDS_PER_TICK"];
+    m_Timestep.reset_statistics();
+    m_PhaseStatistics = CPhaseStatistics();
     
     // Main game loop
     while (!exit) {
         bool pause = false;
+        m_Timestep.start();
         // Run the game until player wins/loses or presses the pause button.
         while (!pause && !exit) {
-            auto startTime = std::chrono::steady_clock::now();
+            auto frameStartTime = std::chrono::steady_clock::now();
             
-            update_input(pause);
-            update_game_state(success, exit);
-            render(renderer);
+            // Simulate all ticks that are due (catch up if the last frame took too long) and render only the last one.
+            size_t ticksDue = m_Timestep.begin_frame();
+            size_t ticks = 0;
+            while (ticks < ticksDue && !pause && !exit) {
+                auto tickStartTime = std::chrono::steady_clock::now();
+                update_input(pause);
+                record_phase(m_PhaseStatistics.m_Input, tickStartTime);
+                update_game_state(success, exit);
+                m_Timestep.tick_simulated(std::chrono::steady_clock::now() - tickStartTime);
+                ticks++;
+                
+                // Nobody can quit a benchmark, so it ends after the given number of ticks (as a loss).
+                if (m_Timestep.get_statistics().m_Ticks == m_TickLimit) {
+                    exit = true;
+                }
+            }
+            if (ticks > 0) {
+                render(renderer, pipeline, frameStartTime);
+            }
             
-            auto endTime = std::chrono::steady_clock::now();
-            std::this_thread::sleep_for(std::chrono::milliseconds(sleepFor) - (endTime - startTime));
+            // The terminal is gone, nobody can see or play the game.
+            if (pipeline.has_failed()) {
+                exit = true;
+            }
+            
+            m_Timestep.end_frame(ticks);
+            wait_for_next_tick();
         }
         if (!exit) {
             pause = false;
-            // Stop the game and wait for the player to press pause or exit.
+            // Stop the game and wait (without using the CPU) for the player to press pause or exit.
             while (!pause && !exit) {
+                m_Backend->wait_for_event(std::chrono::steady_clock::time_point::max());
                 update_input(pause, exit);
+                
+                // The paused game has to be shown again after a resize.
+                if (m_Backend->take_resize()) {
+                    handle_resize();
+                    render(renderer, pipeline, std::chrono::steady_clock::now());
+                }
+                if (pipeline.has_failed()) {
+                    exit = true;
+                }
             }
-            reset_rendering(renderer);
+            reset_rendering();
         }
     }
     
+    // Wait until the last frame gets to the terminal.
+    pipeline.stop();
+    m_RenderStatistics = pipeline.get_statistics();
+    m_InputManager.stop();
+    
     // Reset terminal settings.
     cleanup();
     
     return success;
 }
 
+bool CGame::simulate(const std::string& pathToLevel, CBot& bot) {
+    // Pool statistics reported at the end of the simulation should only cover this level.
+    CMemoryPool::reset_high_water_marks();
+    
+    load(pathToLevel);
+    CMapJoin environment({m_EnvironmentMap});
+    bool exit = false;
+    bool success = false;
+    
+    m_Timestep.reset_statistics();
+    m_PhaseStatistics = CPhaseStatistics();
+    
+    while (!exit) {
+        // The bot takes the place of the keyboard, the player takes its actions the same way as keys.
+        auto tickStartTime = std::chrono::steady_clock::now();
+        bot.act(m_Player, *m_EntitiesMap, environment, *m_PlayerControls);
+        record_phase(m_PhaseStatistics.m_Input, tickStartTime);
+        update_game_state(success, exit);
+        
+        // Nothing gets rendered, so the changed looks would pile up.
+        m_World->get_hurt_objects().clear_changed_looks();
+        
+        // The ticks are not paced, only their number matters.
+        m_Timestep.tick_simulated(CFixedTimestep::Clock::duration::zero());
+        if (m_Timestep.get_statistics().m_Ticks == m_TickLimit) {
+            exit = true;
+        }
+    }
+    
+    return success;
+}
+
 void CGame::update_input(bool& pause) {
     pause = false;
     m_InputManager.update(); // Get keyboard input.
     
-    // Check if the pause button has been pressed.
-    for (auto input: m_UiControls->pop_recorded_inputs()) {
+    // Check if the pause button has been pressed, the other keys are dropped.
+    char input;
+    while (m_UiControls->pop_recorded_input(input)) {
         if (input == m_Config->m_Char["PAUSE"]) {
             pause = true;
-            return;
         }
     }
 }
@@ -121,7 +237,8 @@ void CGame::update_input(bool& pause, bool& exit) {
     m_InputManager.update(); // Get keyboard input.
     
     // Check if the pause or exit button has been pressed.
-    for (auto input: m_UiControls->pop_recorded_inputs()) {
+    char input;
+    while (m_UiControls->pop_recorded_input(input)) {
         if (input == m_Config->m_Char["PAUSE"]) {
             pause = true;
         } else if (input == m_Config->m_Char["QUIT"]) {
@@ -130,22 +247,78 @@ void CGame::update_input(bool& pause, bool& exit) {
     }
 }
 
-void CGame::reset_rendering(CRenderer& renderer) {
-    std::cout << CTerminal::reset_graphics() << CTerminal::erase_entire_screen();
-    renderer.reset(); // Clear both buffers used in renderer.
-    m_HealthDisplay.re_render(std::cout);
-    m_AmmoDisplay.re_render(std::cout);
-    m_CurrentGunDisplay.re_render(std::cout);
+void CGame::wait_for_next_tick() {
+    auto deadline = m_Timestep.next_tick_time();
+    while (std::chrono::steady_clock::now() < deadline) {
+        m_Backend->wait_for_event(deadline);
+        
+        // Keys have to be taken from the terminal, otherwise they would wake the waiting up again right away.
+        m_InputManager.update();
+        if (m_Backend->take_resize()) {
+            handle_resize();
+            deadline = m_Timestep.next_tick_time();
+        }
+    }
+}
+
+void CGame::handle_resize() {
+    if (m_Backend->wait_for_size(levelDimensions.m_X * 2, levelDimensions.m_Y + 5)) {
+        m_Timestep.start();
+    }
+    reset_rendering();
+}
+
+void CGame::reset_rendering() {
+    // The render thread clears the screen and renders everything when it sees a new reset count.
+    m_ResetCount++;
+}
+
+void CGame::set_tick_limit(size_t ticks) {
+    m_TickLimit = ticks;
+}
+
+void CGame::set_recording(const std::string& path) {
+    m_RecordingPath = path;
+}
+
+size_t CGame::get_tick_count() const {
+    return m_Timestep.get_statistics().m_Ticks;
+}
+
+const CFixedTimestep::CStatistics& CGame::get_loop_statistics() const {
+    return m_Timestep.get_statistics();
+}
+
+const CGame::CPhaseStatistics& CGame::get_phase_statistics() const {
+    return m_PhaseStatistics;
+}
+
+bool CGame::has_player_survived() const {
+    return !m_Player.get_object()->is_destroyed();
+}
+
+void CGame::print_statistics(std::ostream& os) const {
+    m_Timestep.get_statistics().print(os);
+    m_PhaseStatistics.print(os);
+    m_RenderStatistics.print(os);
+    os << "Input (from reading a key to acting on it by the player):" << std::endl;
+    m_Player.get_action_latency().print("Action latency", os);
+    m_InputManager.get_statistics().print(os);
 }
 
 void CGame::update_game_state(bool& success, bool& exit) {
     success = false;
     
+    auto phaseStartTime = std::chrono::steady_clock::now();
     update_bullets();
+    phaseStartTime = record_phase(m_PhaseStatistics.m_Bullets, phaseStartTime);
     update_entities();
-    m_BonusManager.update(m_Player, *m_EnvironmentMap);
-    m_EnvironmentMap->update_looks_all_objects();
-    update_interface();
+    phaseStartTime = record_phase(m_PhaseStatistics.m_Entities, phaseStartTime);
+    m_BonusManager.update(m_Player, *m_BonusMap);
+    phaseStartTime = record_phase(m_PhaseStatistics.m_Bonuses, phaseStartTime);
+    // Update visuals of all recently damaged objects.
+    m_World->get_hurt_objects().update();
+    phaseStartTime = record_phase(m_PhaseStatistics.m_Damage, phaseStartTime);
     
     // Player is dead -> exit the game as a loss.
     if (m_Player.get_object()->is_destroyed()) {
@@ -154,7 +327,9 @@ void CGame::update_game_state(bool& success, bool& exit) {
     }
     
     // Player has killed all waves of enemies -> exit the game as a win.
-    if (!m_WavesManager.update(m_Enemies, *m_EntitiesMap)) {
+    bool wavesLeft = m_WavesManager.update(m_Enemies, *m_EntitiesMap);
+    record_phase(m_PhaseStatistics.m_Waves, phaseStartTime);
+    if (!wavesLeft) {
         success = true;
         exit = true;
         return;
@@ -162,45 +337,48 @@ void CGame::update_game_state(bool& success, bool& exit) {
 }
 
 void CGame::update_bullets() {
-    // Update all bullets in %m_Bullets. If a bullet says that it was destroyed, remove from the list.
-    for (auto it = m_Bullets.begin(); it != m_Bullets.end();) {
-        if (it->update(m_BulletsMap, {m_EnvironmentMap, m_EntitiesMap})) {
-            ++it;
-        } else {
-            it = m_Bullets.erase(it);
-        }
-    }
-    // Update visuals of the bullets.
-    m_BulletsMap->update_looks_all_objects();
+    // Update all bullets in %m_Bullets. Destroyed bullets get removed from the container.
+    m_Bullets.update(m_BulletsMap, {m_EnvironmentMap, m_BonusMap, m_EntitiesMap});
 }
 
 void CGame::update_enemies() {
     // Update all enemies in %m_Enemies. If an enemy says that it was killed, we remove it and pass
     // that information to %m_BonusManager, so it decides if a bonus should be dropped from the killed enemy.
-    for (auto it = m_Enemies.begin(); it != m_Enemies.end();) {
-        if ((**it).update(*m_Player.get_object(),
-                          m_EntitiesMap, {m_EnvironmentMap},
+    m_Enemies.update([this](const std::shared_ptr<CEnemy>& enemy, bool acts) {
+        if (enemy->update(acts, *m_Player.get_object(),
+                          m_EntitiesMap, {m_EnvironmentMap, m_BonusMap},
                           m_Bullets, m_BulletsMap)) {
-            ++it;
-        } else {
-            m_BonusManager.maybe_generate_new_bonus_object(
-                    (**it).get_object()->get_position(), (**it).m_Toughness, *m_EnvironmentMap);
-            it = m_Enemies.erase(it);
+            return false;
         }
-    }
+        m_BonusManager.maybe_generate_new_bonus_object(
+                enemy->get_object()->get_position(), enemy->m_Toughness, *m_BonusMap);
+        return true;
+    });
 }
 
 void CGame::update_entities() {
     update_enemies();
-    m_Player.update(m_EntitiesMap, {m_EnvironmentMap}, m_Bullets, m_BulletsMap);
-    m_EntitiesMap->update_looks_all_objects();
+    m_Player.update(m_EntitiesMap, {m_EnvironmentMap, m_BonusMap}, m_Bullets, m_BulletsMap);
+}
+
+void CGame::update_interface(CRenderPipeline::CSnapshot& snapshot) {
+    // Get player's stats, so they can be displayed.
+    snapshot.m_Health = m_Player.get_object()->get_health();
+    snapshot.m_Ammo = m_Player.current_gun()->m_Ammo;
+    snapshot.m_GunName = m_Player.current_gun()->name();
 }
 
-void CGame::update_interface() {
-    // Get player's stats and display them.
-    m_HealthDisplay.update(m_Player.get_object()->get_health(), std::cout);
-    m_AmmoDisplay.update(m_Player.current_gun()->m_Ammo, std::cout);
-    m_CurrentGunDisplay.update(m_Player.current_gun()->name(), std::cout);
+void CGame::render_interface(const CRenderPipeline::CSnapshot& snapshot, bool afterReset, std::ostream& os) {
+    // The screen has been cleared, so the names of the values have to be rendered too.
+    if (afterReset) {
+        m_HealthDisplay.re_render(os);
+        m_AmmoDisplay.re_render(os);
+        m_CurrentGunDisplay.re_render(os);
+    }
+    
+    m_HealthDisplay.update(snapshot.m_Health, os);
+    m_AmmoDisplay.update(snapshot.m_Ammo, os);
+    m_CurrentGunDisplay.update(snapshot.m_GunName, os);
 }
 
 void CGame::setup_interface() {
@@ -208,27 +386,34 @@ void CGame::setup_interface() {
     m_HealthDisplay.set_position(1, levelDimensions.m_Y + 2);
     m_AmmoDisplay.set_position(1, levelDimensions.m_Y + 3);
     m_CurrentGunDisplay.set_position(1, levelDimensions.m_Y + 4);
-    
-    m_HealthDisplay.first_render(std::cout);
-    m_AmmoDisplay.first_render(std::cout);
-    m_CurrentGunDisplay.first_render(std::cout);
 }
 
-void CGame::render(CRenderer& renderer) {
-    // Clear renderer's buffer and put sprites of objects in the game into it.
-    renderer.clear_active_buffer();
-    m_BulletsMap->push_objects_to_render(renderer);
-    m_EntitiesMap->push_objects_to_render(renderer);
-    m_EnvironmentMap->push_objects_to_render(renderer);
+void CGame::render(CRenderer& renderer, CRenderPipeline& pipeline,
+                   std::chrono::steady_clock::time_point tickStartTime) {
+    // Objects that started or stopped being shown as hurt look differently.
+    CHurtObjectsRegistry& hurtObjects = m_World->get_hurt_objects();
+    for (const CPosition& position: hurtObjects.get_changed_looks())
+        m_World->mark_dirty(position);
+    hurtObjects.clear_changed_looks();
     
-    // Compare that with the previous frame and render only differences.
-    renderer.render_differences(std::cout);
-    renderer.switch_active_buffer();
+    // Put sprites of the cells that changed since the last frame into renderer's layers.
+    m_World->push_changes_to_render(renderer);
     
-    // Update user interface.
-    update_interface();
+    // Hand the frame and the user interface over to the render thread.
+    CRenderPipeline::CSnapshot& snapshot = pipeline.snapshot_to_publish();
+    renderer.export_frame(snapshot);
+    update_interface(snapshot);
+    snapshot.m_ResetCount = m_ResetCount;
+    pipeline.publish(std::chrono::steady_clock::now() - tickStartTime);
+}
+
+std::chrono::steady_clock::time_point CGame::record_phase(CLatencyStatistics& phase,
+                                                         std::chrono::steady_clock::time_point startTime) {
+    auto endTime = std::chrono::steady_clock::now();
+    phase.record(endTime - startTime);
+    return endTime;
 }
 
 void CGame::cleanup() {
-    CTerminal::reset_terminal();
+    m_Backend->reset();
 }
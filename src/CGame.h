@@ -6,24 +6,106 @@
 #include "CInputManager.h"
 #include "CBonusManager.h"
 #include "CFactory.h"
+#include "CHurtObjectsRegistry.h"
+#include "CEnemyStore.h"
+#include "CBulletStore.h"
+#include "CMemoryPool.h"
+#include "CRenderPipeline.h"
+#include "CTerminalBackend.h"
+#include "CFixedTimestep.h"
+#include "CLatencyStatistics.h"
+#include "CBot.h"
 
 /// @brief Class for the game itself, that gets played.
 class CGame {
 public:
+    
+    /// Durations of the phases of the game ticks.
+    struct CPhaseStatistics {
+        
+        /// Prints the statistics.
+        /// @param[in, out] os Stream to print into.
+        void print(std::ostream& os) const;
+        
+        /// Taking the input of the player (keys or the actions of a bot).
+        CLatencyStatistics m_Input;
+        
+        /// Updating the bullets.
+        CLatencyStatistics m_Bullets;
+        
+        /// Updating the enemies and the player.
+        CLatencyStatistics m_Entities;
+        
+        /// Updating the bonuses.
+        CLatencyStatistics m_Bonuses;
+        
+        /// Updating looks of hurt objects (see CHurtObjectsRegistry).
+        CLatencyStatistics m_Damage;
+        
+        /// Spawning waves of enemies (see CWavesManager).
+        CLatencyStatistics m_Waves;
+    };
+    
     /// Constructor of CGame.
     /// @param[in] config Pointer to const configuration of the application the game is running in.
-    explicit CGame(const std::shared_ptr<const CConfig>& config);
+    /// @param[in] backend Terminal the game is played in.
+    CGame(const std::shared_ptr<const CConfig>& config, std::shared_ptr<CTerminalBackend> backend);
     
     /// Method that loads level and plays it.
     /// @para[in] pathToLevel Path to the level to be played.
     /// @throws std::invalid_argument if the level could not be loaded properly.
     bool run(const std::string& pathToLevel);
+    
+    /// Loads a level and lets a bot play it as fast as possible - without the terminal, waiting between the ticks
+    /// or rendering. Meant for balancing levels, set a tick limit (see 'set_tick_limit()') if the bot may not finish.
+    /// @param[in] pathToLevel Path to the level to be played.
+    /// @param[in, out] bot Bot playing instead of the player.
+    /// @return Whether the bot has beaten the level.
+    /// @throws std::invalid_argument if the level could not be loaded properly.
+    bool simulate(const std::string& pathToLevel, CBot& bot);
+    
+    /// Limits the number of ticks the game can take. When the limit is reached, the game ends as a loss.
+    /// Meant for benchmarks, where nobody could quit the game.
+    /// @param[in] ticks Maximum number of ticks (0 means there is no limit).
+    void set_tick_limit(size_t ticks);
+    
+    /// Records the frames of the game into a file (see CFrameRecorder), so it can be replayed later.
+    /// @param[in] path Path to the recording, it gets overwritten by every game (empty string means no recording).
+    void set_recording(const std::string& path);
+    
+    /// @return Number of ticks the last game took.
+    [[nodiscard]] size_t get_tick_count() const;
+    
+    /// @return What happened to the ticks of the last game - overruns, skipped frames, ...
+    [[nodiscard]] const CFixedTimestep::CStatistics& get_loop_statistics() const;
+    
+    /// @return Durations of the phases of the ticks of the last game.
+    [[nodiscard]] const CPhaseStatistics& get_phase_statistics() const;
+    
+    /// @return Whether the player has been alive at the end of the last game.
+    [[nodiscard]] bool has_player_survived() const;
+    
+    /// Prints what happened to the ticks (see CFixedTimestep), durations of their phases, durations of the stages
+    /// of rendering (see CRenderPipeline) and latency of the keys (see CInputManager) in the last game.
+    /// @param[in, out] os Stream to print into.
+    void print_statistics(std::ostream& os) const;
 
 private:
-    /// Sets up internal variables of the CGame.
+    /// Sets up internal variables of the CGame and the terminal.
     /// @param[in] pathToLevel Path to load the level from.
     void setup(const std::string& pathToLevel);
     
+    /// Loads the level and creates the player.
+    /// @param[in] pathToLevel Path to load the level from.
+    void load(const std::string& pathToLevel);
+    
+    /// Records the duration of a phase of a tick.
+    /// @param[out] phase Statistics of the phase.
+    /// @param[in] startTime When the phase started.
+    /// @return When the phase ended (and the next one started).
+    static std::chrono::steady_clock::time_point record_phase(CLatencyStatistics& phase,
+                                                              std::chrono::steady_clock::time_point startTime);
+    
     /// Updates keyboard input.
     /// @param[out] pause Whether player pressed the pause button.
     /// @param[out] exit Whether player pressed the exit button.
@@ -49,28 +131,48 @@ private:
     /// This method is called from 'update_entities()'.
     void update_enemies();
     
-    /// Updates user interface so it shows in-game variables up to date.
-    void update_interface();
+    /// Copies in-game variables shown by the user interface into a snapshot.
+    /// @param[out] snapshot Snapshot to fill.
+    void update_interface(CRenderPipeline::CSnapshot& snapshot);
+    
+    /// Renders user interface of a snapshot. Called on the render thread of the pipeline.
+    /// @param[in] snapshot Snapshot with the values to show.
+    /// @param[in] afterReset Whether the screen has been cleared, so everything has to be rendered.
+    /// @param[in, out] os Stream to render into.
+    void render_interface(const CRenderPipeline::CSnapshot& snapshot, bool afterReset, std::ostream& os);
     
-    /// Sets up interface - meaning setting the position of elements and rendering them.
+    /// Sets up interface - meaning setting the position of elements.
+    /// They get rendered with the first frame.
     void setup_interface();
     
-    /// Renders the state of the game.
-    /// @param[in, out] renderer Renderer used for displaying the state of the game.
-    void render(CRenderer& renderer);
+    /// Composes the state of the game and publishes it to the render thread.
+    /// @param[in, out] renderer Renderer used for composing the frame.
+    /// @param[in, out] pipeline Pipeline rendering the frames.
+    /// @param[in] tickStartTime When the tick that is being rendered started.
+    void render(CRenderer& renderer, CRenderPipeline& pipeline, std::chrono::steady_clock::time_point tickStartTime);
+    
+    /// Waits until the next tick is due (see CFixedTimestep) without using the CPU.
+    /// Keys pressed in the meantime are read right away (they are processed by the next tick)
+    /// and resizes of the terminal are handled (see 'handle_resize()').
+    void wait_for_next_tick();
+    
+    /// Reacts to a resize of the terminal - waits until the level fits into it again and renders everything again.
+    /// If the game had to wait, the clock of the game loop starts again, so the time is not caught up.
+    void handle_resize();
     
-    /// Renderers entire game. This is useful when the rendering breaks in some way.
+    /// Renderers entire game with the next frame. This is useful when the rendering breaks in some way.
     /// This method is also called after exiting pause of the game.
-    /// @param[out] renderer Renderer that should be reset - meaning it will render every
-    ///                      element and not just differences between frames.
-    void reset_rendering(CRenderer& renderer);
+    void reset_rendering();
     
-    /// Static method that resets terminal to its original state.
-    static void cleanup();
+    /// Method that resets terminal to its original state.
+    void cleanup();
     
     /// Configuration of the application the game is running in.
     std::shared_ptr<const CConfig> m_Config;
     
+    /// Terminal the game is played in.
+    std::shared_ptr<CTerminalBackend> m_Backend;
+    
     /// Factory that creates object loaded from %m_Config.
     std::shared_ptr<const CFactory> m_Factory;
     
@@ -92,20 +194,26 @@ private:
     /// Updates the state of %m_PlayerControls and %m_UiControls.
     CInputManager m_InputManager;
     
+    /// Occupancy grid of the game - all maps below are views of its layers.
+    std::shared_ptr<CWorldMap> m_World;
+    
     /// Map storing bullets in the game by their position.
     std::shared_ptr<CMap> m_BulletsMap;
     
     /// Map storing entities (player + enemies) in the game by their position.
     std::shared_ptr<CMap> m_EntitiesMap;
     
-    /// Map storing static objects (walls + bonuses that are not picked up yet) in the game by their position.
+    /// Map storing static objects (walls) in the game by their position.
     std::shared_ptr<CMap> m_EnvironmentMap;
     
-    /// List of enemies in the game.
-    std::list<std::shared_ptr<CEnemy>> m_Enemies;
+    /// Map storing bonuses that are not picked up yet by their position.
+    std::shared_ptr<CMap> m_BonusMap;
+    
+    /// Enemies in the game (see CEnemyStore).
+    CEnemyStore m_Enemies;
     
-    /// List of bullets in the game.
-    std::list<CBullet> m_Bullets;
+    /// Bullets in the game (see CBulletStore).
+    CBulletStore m_Bullets;
     
     /// Object representing player.
     CPlayer m_Player;
@@ -121,4 +229,22 @@ private:
     
     /// UI element displaying name of the gun that player has currently selected.
     CValueDisplay<std::string> m_CurrentGunDisplay;
+    
+    /// Number of requests to render the whole screen again (see CRenderPipeline::CSnapshot::m_ResetCount).
+    uint64_t m_ResetCount;
+    
+    /// Statistics of the rendering in the last game.
+    CRenderPipeline::CStatistics m_RenderStatistics;
+    
+    /// Maximum number of ticks of a game (0 means there is no limit).
+    size_t m_TickLimit;
+    
+    /// Durations of the phases of the ticks of the last game.
+    CPhaseStatistics m_PhaseStatistics;
+    
+    /// Clock of the game loop, it decides when ticks are simulated and frames rendered.
+    CFixedTimestep m_Timestep;
+    
+    /// Path to the recording of the frames (empty if the frames are not recorded).
+    std::string m_RecordingPath;
 };
@@ -10,12 +10,12 @@ CGun::CGun(std::string name, const CBulletObjectBuilder& bulletBuilder, int maxA
           m_Name(std::move(name)),
           m_MaxAmmo(maxAmmo) {}
 
-void CGun::spawn_bullet(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+void CGun::spawn_bullet(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                         const CPosition& positionOfShooting, const CMapJoin& environment,
                         VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) const {
     
     // Create a bullet object.
-    std::shared_ptr<CMovableObject> bullet =
+    std::shared_ptr<CBulletObject> bullet =
             m_BulletBuilder.build_bullet(positionOfShooting, vOrientation, hOrientation, m_DoubleBullets);
     
     // Try how the bullet behaves if it was put into environment.
@@ -23,7 +23,7 @@ void CGun::spawn_bullet(std::list<CBullet>& bullets, const std::shared_ptr<CMap>
     if (!bullet->is_destroyed()) {
         
         // Bullet did not get destroyed -> add it to the bullets into containers.
-        bullets.emplace_back(bullet,
+        bullets.emplace(bullet,
                              CUtilities::direction_from_vh_orientations(vOrientation, hOrientation),
                              m_BulletBuilder.get_move_period());
         bulletMap->add_object(bullet);
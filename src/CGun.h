@@ -1,8 +1,9 @@
 #pragma once
 
-#include "CBullet.h"
+#include "CBulletStore.h"
 #include "CDamagingMovableObject.h"
 #include "CBulletObjectBuilder.h"
+#include "CTimeTicks.h"
 #include <utility>
 
 /// @brief Abstract class representing a gun in the game.
@@ -28,12 +29,12 @@ public:
     
     /// Pure virtual method that children of this class implement in their own way so
     /// the different types of guns shoot in different way.
-    /// @param[in, out] bullets List of bullets in the game so the gun can add a bullet into in.
+    /// @param[in, out] bullets Container of bullets in the game so the gun can add a bullet into in.
     /// @param[in, out] bulletMap CMap containing bullet objects in the game so the gun can add a bullet into in.
     /// @param[in, out] positionOfShooting Position where the entity holding the gun currently is.
     /// @param[in, out] vOrientation VERTICAL orientation of entity holding the gun.
     /// @param[in, out] hOrientation HORIZONTAL orientation of entity holding the gun.
-    virtual void shoot(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+    virtual void shoot(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                        const CPosition& positionOfShooting, const CMapJoin& environment,
                        VOrientation::EVOrientation vOrientation,
                        HOrientation::EHOrientation hOrientation) = 0;
@@ -65,14 +66,14 @@ protected:
     /// Helper method that creates a bullet and puts it into game containers if it was successful.
     /// For example if the new bullet collides with its environment right away, it will
     /// just collide with it and not get added to containers.
-    /// @param[out] bullets List of bullets that this method can add a bullet into.
+    /// @param[out] bullets Container of bullets that this method can add a bullet into.
     /// @param[in] bulletMap Pointer to a map that contains bullet objects so it can be
     ///                      updated in the case the bullet gets spawned.
     /// @param[in] positionOfShooting Position where the bullet should spawn.
     /// @param[in, out] environment Map of objects that can be effected by the new spawned bullet.
     /// @param[in] vOrientation VERTICAL orientation that the spawned bullet should have.
     /// @param[in] hOrientation HORIZONTAL orientation that the spawned bullet should have.
-    void spawn_bullet(std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap,
+    void spawn_bullet(CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap,
                       const CPosition& positionOfShooting, const CMapJoin& environment,
                       VOrientation::EVOrientation vOrientation,
                       HOrientation::EHOrientation hOrientation) const;
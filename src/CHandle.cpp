@@ -0,0 +1,27 @@
+#include "CHandle.h"
+
+CHandle::CHandle()
+        : m_Value(0) {}
+
+CHandle::CHandle(uint32_t index, uint32_t generation)
+        : m_Value((generation << INDEX_BITS) | (index & (MAX_SLOTS - 1))) {}
+
+uint32_t CHandle::index() const {
+    return m_Value & (MAX_SLOTS - 1);
+}
+
+uint32_t CHandle::generation() const {
+    return m_Value >> INDEX_BITS;
+}
+
+bool CHandle::is_null() const {
+    return generation() == 0;
+}
+
+bool CHandle::operator==(const CHandle& other) const {
+    return m_Value == other.m_Value;
+}
+
+bool CHandle::operator!=(const CHandle& other) const {
+    return m_Value != other.m_Value;
+}
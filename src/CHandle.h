@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+/// @brief Generational handle referring to a value stored in CSlotMap.
+///        The lower bits hold the index of the slot and the upper bits hold the generation of the slot.
+///        The generation changes whenever the slot gets reused, so a handle to an erased value
+///        (a stale handle) is recognized and resolves to nullptr instead of to a different value.
+class CHandle {
+public:
+    
+    /// Number of bits used for the index of the slot.
+    static constexpr int INDEX_BITS = 20;
+    
+    /// Maximum number of slots that can be addressed by a handle.
+    static constexpr uint32_t MAX_SLOTS = 1u << INDEX_BITS;
+    
+    /// Number of distinct generations of one slot (generation zero is reserved for null handles).
+    static constexpr uint32_t GENERATION_COUNT = 1u << (32 - INDEX_BITS);
+    
+    /// Constructor of a null handle which never refers to any value.
+    CHandle();
+    
+    /// Constructor of CHandle.
+    /// @param[in] index Index of the slot.
+    /// @param[in] generation Generation of the slot.
+    CHandle(uint32_t index, uint32_t generation);
+    
+    /// @return Index of the slot the handle refers to.
+    [[nodiscard]] uint32_t index() const;
+    
+    /// @return Generation of the slot the handle refers to.
+    [[nodiscard]] uint32_t generation() const;
+    
+    /// @return Whether the handle is a null handle.
+    [[nodiscard]] bool is_null() const;
+    
+    /// Operator == comparing handles.
+    /// @return True if both handles refer to the same slot of the same generation.
+    bool operator==(const CHandle& other) const;
+    
+    /// Operator != comparing handles.
+    /// @return True if the handles are not equal.
+    bool operator!=(const CHandle& other) const;
+
+private:
+    
+    /// Index and generation packed into one 32-bit word.
+    uint32_t m_Value;
+};
@@ -14,6 +14,6 @@ bool CHealBonus::during(CPlayer& player) {
 void CHealBonus::on_end(CPlayer& player) {}
 
 std::shared_ptr<CBonus> CHealBonus::clone() const {
-    return std::make_shared<CHealBonus>(*this);
+    return CPoolAllocator<CHealBonus>::make_shared(*this);
 }
 
@@ -0,0 +1,52 @@
+#include "CHunterBot.h"
+
+void CHunterBot::act(const CPlayer& player, const CMap& entities,
+                     const CMapJoin& environment, CActionsInputRecorder& controls) {
+    const CMovableObject& object = *player.get_object();
+    const CPosition& position = object.get_position();
+    
+    // The player is the nearest entity to itself, so the nearest enemy is the other one.
+    std::shared_ptr<CObject> target;
+    for (const auto& entity: entities.nearest_objects(position, 2)) {
+        if (entity.get() != &object) {
+            target = entity;
+            break;
+        }
+    }
+    if (target == nullptr)
+        return;
+    
+    // Shoot when the enemy is in sight, turn to it first if needed.
+    Direction::EDirection facingDirection = CUtilities::direction_from_vh_orientations(
+            object.get_v_orientation(), object.get_h_orientation());
+    Direction::EDirection sightDirection = direction_of_sight(position, target->get_position(), environment);
+    Action::EAction action;
+    if (sightDirection == Direction::NONE) {
+        action = m_NavigationAi.decide_action(position, target->get_position(), environment, facingDirection);
+    } else if (sightDirection == facingDirection) {
+        action = Action::ATTACK;
+    } else {
+        action = CUtilities::action_from_direction(sightDirection);
+    }
+    controls.record_action(action, std::chrono::steady_clock::now());
+}
+
+Direction::EDirection CHunterBot::direction_of_sight(const CPosition& position, const CPosition& target,
+                                                     const CMapJoin& environment) {
+    Direction::EDirection direction;
+    int distance;
+    if (position.m_Y == target.m_Y && position.m_X != target.m_X) {
+        direction = target.m_X > position.m_X ? Direction::RIGHT : Direction::LEFT;
+        distance = std::abs(target.m_X - position.m_X);
+    } else if (position.m_X == target.m_X && position.m_Y != target.m_Y) {
+        direction = target.m_Y > position.m_Y ? Direction::DOWN : Direction::UP;
+        distance = std::abs(target.m_Y - position.m_Y);
+    } else {
+        return Direction::NONE;
+    }
+    
+    // Only the cells between the bot and the target can block the sight.
+    if (distance > SIGHT || environment.first_blocker(position, direction, distance - 1) != -1)
+        return Direction::NONE;
+    return direction;
+}
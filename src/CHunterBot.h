@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CBot.h"
+#include "CSimpleFollowerAi.h"
+#include "CUtilities.h"
+
+/// @brief Bot that hunts the nearest enemy. It plays like a ranged enemy (see CRangedEnemyAi) with roles swapped -
+///        it shoots when the enemy is in a direct line of sight and walks towards it otherwise.
+///        The enemy is found by the spatial query of the world (see CWorldMap::nearest_objects()). The line of sight
+///        is cast by the bot itself, the visibility index of the world (see CWorldMap::direction_of_sight())
+///        is kept for the enemies, which all look at the player.
+class CHunterBot : public CBot {
+public:
+    
+    /// Distance the bot looks into when searching for an enemy to shoot.
+    static constexpr int SIGHT = 20;
+    
+    /// Records the action of a ranged enemy AI targeting the nearest enemy (nothing if there is no enemy).
+    /// @param[in] player Player controlled by the bot.
+    /// @param[in] entities Map of the player and the enemies.
+    /// @param[in] environment Map of objects that block the player (walls).
+    /// @param[in, out] controls Controls of the player.
+    void act(const CPlayer& player, const CMap& entities,
+             const CMapJoin& environment, CActionsInputRecorder& controls) override;
+
+private:
+    
+    /// @param[in] position Position to look from.
+    /// @param[in] target Position that should be seen.
+    /// @param[in] environment Map of objects that block the sight.
+    /// @return Direction in which %target is seen within %SIGHT or Direction::NONE if it cannot be seen.
+    static Direction::EDirection direction_of_sight(const CPosition& position, const CPosition& target,
+                                                    const CMapJoin& environment);
+    
+    /// AI deciding the movement when the enemy cannot be seen.
+    CSimpleFollowerAi m_NavigationAi;
+};
@@ -0,0 +1,54 @@
+#include "CHurtObjectsRegistry.h"
+#include "CObject.h"
+
+CHurtObjectsRegistry::CHurtObjectsRegistry()
+        : m_CurrentTick(0) {}
+
+CHurtObjectsRegistry::~CHurtObjectsRegistry() {
+    clear();
+}
+
+uint64_t CHurtObjectsRegistry::add(CObject* object) {
+    uint64_t expiryTick = m_CurrentTick + HURT_DURATION;
+    m_HurtObjects.emplace(expiryTick, object);
+    m_ChangedLooks.push_back(object->get_position());
+    return expiryTick;
+}
+
+void CHurtObjectsRegistry::remove(CObject* object, uint64_t expiryTick) {
+    m_HurtObjects.erase({expiryTick, object});
+}
+
+void CHurtObjectsRegistry::update() {
+    m_CurrentTick++;
+    
+    // The set is ordered by the expiry tick -> all expired objects are at its beginning.
+    while (!m_HurtObjects.empty() && m_HurtObjects.begin()->first <= m_CurrentTick) {
+        CObject* object = m_HurtObjects.begin()->second;
+        m_HurtObjects.erase(m_HurtObjects.begin());
+        object->update_looks();
+        m_ChangedLooks.push_back(object->get_position());
+    }
+}
+
+void CHurtObjectsRegistry::clear() {
+    // The objects forget the registry, so they do not reach it after it is gone.
+    while (!m_HurtObjects.empty()) {
+        CObject* object = m_HurtObjects.begin()->second;
+        m_HurtObjects.erase(m_HurtObjects.begin());
+        object->update_looks();
+    }
+    m_ChangedLooks.clear();
+}
+
+size_t CHurtObjectsRegistry::size() const {
+    return m_HurtObjects.size();
+}
+
+const std::vector<CPosition>& CHurtObjectsRegistry::get_changed_looks() const {
+    return m_ChangedLooks;
+}
+
+void CHurtObjectsRegistry::clear_changed_looks() {
+    m_ChangedLooks.clear();
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <functional>
+#include <vector>
+#include "CPoolAllocator.h"
+#include "CPosition.h"
+
+class CObject;
+
+/// @brief Class keeping the set of objects that have been recently damaged (and are shown as hurt).
+///        Every world (see CWorldMap) owns one, so the registry lives only as long as the game that uses it.
+///        The objects are ordered by the game tick at which their damage indication runs out,
+///        so each tick only the objects whose indication has just run out get updated
+///        instead of every object in the game.
+///        Positions of objects that started or stopped being shown as hurt are collected,
+///        so only their cells get rendered again (see 'get_changed_looks()').
+class CHurtObjectsRegistry {
+public:
+    /// Default constructor of CHurtObjectsRegistry - no object is shown as hurt.
+    CHurtObjectsRegistry();
+    
+    /// Destructor of CHurtObjectsRegistry. The registered objects stop being shown as hurt (see 'clear()').
+    ~CHurtObjectsRegistry();
+    
+    /// The registered objects refer to the registry, so it cannot be copied.
+    CHurtObjectsRegistry(const CHurtObjectsRegistry& other) = delete;
+    
+    /// The registered objects refer to the registry, so it cannot be copied.
+    CHurtObjectsRegistry& operator=(const CHurtObjectsRegistry& other) = delete;
+    
+    /// Number of game ticks an object is shown as hurt after it has been damaged.
+    static constexpr int HURT_DURATION = 10;
+    
+    /// Registers an object that has just been damaged.
+    /// @param[in] object Object that has been damaged.
+    /// @return Game tick at which the damage indication of %object runs out.
+    uint64_t add(CObject* object);
+    
+    /// Unregisters an object, for example when it gets destroyed.
+    /// @param[in] object Object to unregister.
+    /// @param[in] expiryTick Tick returned by 'add()' when %object was registered.
+    void remove(CObject* object, uint64_t expiryTick);
+    
+    /// Advances the game tick and calls 'update_looks()' on all objects whose damage indication has run out.
+    /// Should be called once per game tick.
+    void update();
+    
+    /// Unregisters all objects - they stop being shown as hurt - and forgets the changed looks.
+    /// Should be called when a new game starts in the same world.
+    void clear();
+    
+    /// @return Number of objects that are currently shown as hurt.
+    [[nodiscard]] size_t size() const;
+    
+    /// @return Positions of objects that started or stopped being shown as hurt since the last call
+    ///         of 'clear_changed_looks()'.
+    [[nodiscard]] const std::vector<CPosition>& get_changed_looks() const;
+    
+    /// Forgets the positions returned by 'get_changed_looks()'. Should be called once they are rendered.
+    void clear_changed_looks();
+
+private:
+    
+    /// Current game tick.
+    uint64_t m_CurrentTick;
+    
+    /// Hurt objects ordered by the tick at which their damage indication runs out.
+    /// Nodes of the set are taken from a memory pool, since objects get damaged all the time.
+    std::set<std::pair<uint64_t, CObject*>, std::less<>,
+             CPoolAllocator<std::pair<uint64_t, CObject*>, CHurtObjectsRegistry>> m_HurtObjects;
+    
+    /// Positions of objects whose looks have changed (see 'get_changed_looks()').
+    std::vector<CPosition> m_ChangedLooks;
+};
@@ -0,0 +1,9 @@
+#include "CIdleBot.h"
+
+void CIdleBot::act(const CPlayer& player, const CMap& entities,
+                   const CMapJoin& environment, CActionsInputRecorder& controls) {
+    static_cast<void>(player);
+    static_cast<void>(entities);
+    static_cast<void>(environment);
+    static_cast<void>(controls);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CBot.h"
+
+/// @brief Bot that never does anything, it shows how long the player survives the waves without fighting.
+class CIdleBot : public CBot {
+public:
+    
+    /// Records nothing.
+    /// @param[in] player Player controlled by the bot.
+    /// @param[in] entities Map of the player and the enemies.
+    /// @param[in] environment Map of objects that block the player (walls).
+    /// @param[in, out] controls Controls of the player.
+    void act(const CPlayer& player, const CMap& entities,
+             const CMapJoin& environment, CActionsInputRecorder& controls) override;
+};
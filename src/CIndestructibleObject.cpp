@@ -1,6 +1,6 @@
 #include "CIndestructibleObject.h"
 
-bool CIndestructibleObject::deal_damage(int damagePoints) {
+bool CIndestructibleObject::deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects) {
     return false;
 }
 
@@ -19,7 +19,7 @@ public:
     
     /// This method does nothing to instances of this class.
     /// @return always false (meaning the object was not destroyed).
-    bool deal_damage(int damagePoints) override;
+    bool deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects) override;
     
     /// @return A pointer to a new instance of CIndestructibleObject.
     [[nodiscard]] std::shared_ptr<CObject> clone() const override;
@@ -1,20 +1,100 @@
 #include "CInputManager.h"
 
+void CInputManager::CStatistics::print(std::ostream& os) const {
+    os << " Dropped keys: " << m_DroppedKeys << std::endl;
+}
+
+CInputManager::CInputManager(std::shared_ptr<CTerminalBackend> backend,
+                             std::initializer_list<std::shared_ptr<CInputRecorder>> recorderList)
+        : m_Backend(std::move(backend)), m_ManagedRecorders(recorderList), m_KeyTable(), m_ReadBuffer(),
+          m_Events(), m_Queue(QUEUE_CAPACITY), m_Stopping(false) {
+    if (m_ManagedRecorders.size() > MAX_RECORDERS)
+        throw std::invalid_argument("too many input recorders");
+    
+    // Revisions start at 0, so the table gets filled by the first update if any recorder has a key.
+    m_Revisions.resize(m_ManagedRecorders.size(), 0);
+}
+
+CInputManager::~CInputManager() {
+    stop();
+}
+
+void CInputManager::start() {
+    stop();
+    m_Statistics = CStatistics();
+    m_Stopping.store(false, std::memory_order_release);
+    m_InputThread = std::thread(&CInputManager::input_loop, this);
+}
+
+void CInputManager::stop() {
+    if (!m_InputThread.joinable())
+        return;
+    
+    m_Stopping.store(true, std::memory_order_release);
+    m_Backend->interrupt_input_wait();
+    m_InputThread.join();
+    m_Queue.clear();
+}
+
 void CInputManager::update() {
-    char input;
-    // Load all characters from the input and put them
-    // into managed recorders.
-    while (true) {
-        input = CTerminal::get_non_blocking_input();
-        if (input == CTerminal::no_input()) break;
-        for (auto& recorder: m_ManagedRecorders) {
-            recorder->record_input(input);
+    update_key_table();
+    
+    // Take all keys from the queue and put them
+    // into managed recorders that register them.
+    size_t count;
+    do {
+        count = m_Queue.read(m_Events.data(), m_Events.size());
+        for (size_t i = 0; i < count; ++i) {
+            const CKeyEvent& event = m_Events[i];
+            for (uint32_t recorders = m_KeyTable[static_cast<unsigned char>(event.m_Key)]; recorders != 0; recorders &= recorders - 1) {
+                m_ManagedRecorders[__builtin_ctz(recorders)]->record_input(event.m_Key, event.m_Time);
+            }
         }
+    } while (count == m_Events.size());
+}
+
+const CInputManager::CStatistics& CInputManager::get_statistics() const {
+    return m_Statistics;
+}
+
+void CInputManager::input_loop() {
+    while (!m_Stopping.load(std::memory_order_acquire)) {
+        m_Backend->wait_for_input();
+        
+        // Read everything that is waiting, keys read at once have arrived together.
+        size_t count;
+        bool anyKey = false;
+        do {
+            count = m_Backend->read_input(m_ReadBuffer.data(), m_ReadBuffer.size());
+            auto now = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i) {
+                CKeyEvent event{m_ReadBuffer[i], now};
+                if (m_Queue.write(&event, 1) == 0)
+                    m_Statistics.m_DroppedKeys++;
+            }
+            anyKey = anyKey || count > 0;
+        } while (count == m_ReadBuffer.size());
+        
+        // Wake up the game, it may be paused and waiting for a key.
+        if (anyKey)
+            m_Backend->notify_event();
     }
 }
 
-CInputManager::CInputManager(std::initializer_list<std::shared_ptr<CInputRecorder>> recorderList) {
-    for (const auto& recorder: recorderList) {
-        m_ManagedRecorders.push_back(recorder);
+void CInputManager::update_key_table() {
+    bool changed = false;
+    for (size_t i = 0; i < m_ManagedRecorders.size(); ++i) {
+        changed = changed || m_Revisions[i] != m_ManagedRecorders[i]->get_revision();
+        m_Revisions[i] = m_ManagedRecorders[i]->get_revision();
+    }
+    if (!changed)
+        return;
+    
+    m_KeyTable.fill(0);
+    for (size_t key = 0; key < m_KeyTable.size(); ++key) {
+        for (size_t i = 0; i < m_ManagedRecorders.size(); ++i) {
+            if (m_ManagedRecorders[i]->is_recordable(static_cast<char>(key)))
+                m_KeyTable[key] |= uint32_t(1) << i;
+        }
     }
 }
@@ -1,26 +1,125 @@
 #pragma once
 
-#include <list>
+#include <vector>
+#include <array>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
 #include "CInputRecorder.h"
-#include "CTerminal.h"
+#include "CTerminalBackend.h"
+#include "CSpscRing.h"
 
 /// @brief Class for getting input from keyboard. Recorded keys are then sent to
 ///        instances of CInputRecorder that decide, if they want to store that input or not.
 ///        It is helpful to have multiple CInputRecorders - for instance deviding keyboard input
 ///        into player controls and ui controls (pause or quit).
+///        Keys are read by an input thread as soon as they are pressed (see 'start()'), which stamps them
+///        with the time of arrival and passes them to the game through a lock-free queue (see CSpscRing).
+///        The game takes them by 'update()', every key goes only to the recorders registering it,
+///        which are looked up in a table indexed by the key. The recorders get the time of arrival as well,
+///        so the latency can be measured where the game acts on the key (see CPlayer::get_action_latency()).
 class CInputManager {
 public:
     
+    /// Key read by the input thread.
+    struct CKeyEvent {
+        
+        /// The pressed key.
+        char m_Key;
+        
+        /// When the key has been read from the terminal.
+        std::chrono::steady_clock::time_point m_Time;
+    };
+    
+    /// What happened to the keys since the input thread has been started.
+    struct CStatistics {
+        
+        /// Prints the statistics.
+        /// @param[in, out] os Stream to print into.
+        void print(std::ostream& os) const;
+        
+        /// Number of keys dropped because the queue was full (written by the input thread).
+        size_t m_DroppedKeys = 0;
+    };
+    
+    /// Maximum number of recorders (one bit of the table each).
+    static constexpr size_t MAX_RECORDERS = 32;
+    
+    /// Number of keys read from the terminal or taken from the queue at once.
+    static constexpr size_t BUFFER_SIZE = 256;
+    
+    /// Number of keys the queue between the input thread and the game can hold.
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+    
     /// Constructor of CInputManager.
+    /// @param [in] backend Terminal the keys are read from.
     /// @param [in] recorderList List of pointers of recorders that should receive updates
     ///                          from this CInputManager.
-    CInputManager(std::initializer_list<std::shared_ptr<CInputRecorder>> recorderList);
+    /// @throws std::invalid_argument When there are more than MAX_RECORDERS recorders.
+    CInputManager(std::shared_ptr<CTerminalBackend> backend,
+                  std::initializer_list<std::shared_ptr<CInputRecorder>> recorderList);
+    
+    /// Destructor of CInputManager. Stops the input thread if it is running (see 'stop()').
+    ~CInputManager();
     
-    /// Gets input from keyboard and distributes it into managed CInputRecorders.
+    /// The input thread refers to the instance, so it cannot be copied.
+    CInputManager(const CInputManager& other) = delete;
+    
+    /// The input thread refers to the instance, so it cannot be copied.
+    CInputManager& operator=(const CInputManager& other) = delete;
+    
+    /// Starts the input thread and resets the statistics. The terminal has to be in the game mode
+    /// (see CTerminalBackend::game_mode_on()), otherwise the keys would not get to it one by one.
+    void start();
+    
+    /// Stops the input thread. Keys it has read and the game has not taken are dropped.
+    void stop();
+    
+    /// Distributes the keys read by the input thread into managed CInputRecorders.
     void update();
+    
+    /// @return Statistics of the keys. Complete only after 'stop()'.
+    [[nodiscard]] const CStatistics& get_statistics() const;
 private:
     
+    /// Main function of the input thread.
+    void input_loop();
+    
+    /// Fills %m_KeyTable again if keys have been added to any of the recorders.
+    void update_key_table();
+    
+    /// Terminal the keys are read from.
+    std::shared_ptr<CTerminalBackend> m_Backend;
+    
     /// List of recorders that should receive updates about keyboard input.
-    std::list<std::shared_ptr<CInputRecorder>> m_ManagedRecorders;
+    std::vector<std::shared_ptr<CInputRecorder>> m_ManagedRecorders;
+    
+    /// Revisions of the recorders (see CInputRecorder::get_revision()) %m_KeyTable has been filled with.
+    std::vector<size_t> m_Revisions;
+    
+    /// Bitmask of the recorders registering each key, bit i stands for %m_ManagedRecorders[i].
+    std::array<uint32_t, CInputRecorder::KEY_COUNT> m_KeyTable;
+    
+    /// Buffer the input thread reads the keys into.
+    std::array<char, BUFFER_SIZE> m_ReadBuffer;
+    
+    /// Buffer the game takes the keys from the queue into.
+    std::array<CKeyEvent, BUFFER_SIZE> m_Events;
+    
+    /// Keys passed from the input thread to the game.
+    CSpscRing<CKeyEvent> m_Queue;
+    
+    /// Set when the input thread should stop.
+    std::atomic<bool> m_Stopping;
+    
+    /// Statistics of the keys.
+    CStatistics m_Statistics;
+    
+    /// Thread reading the keys.
+    std::thread m_InputThread;
 };
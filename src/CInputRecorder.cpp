@@ -1,28 +1,42 @@
 #include "CInputRecorder.h"
 
-void CInputRecorder::record_input(char input) {
-    if (m_RecordableInputs.find(input) != m_RecordableInputs.end()) {
-        m_RecordedInputs.push_back(input);
+void CInputRecorder::record_input(char input, std::chrono::steady_clock::time_point time) {
+    static_cast<void>(time);
+    if (is_recordable(input)) {
+        m_RecordedInputs.write(&input, 1);
     }
 }
 
 CInputRecorder& CInputRecorder::add_recordable_input(char newInput) {
-    m_RecordableInputs.insert(newInput);
+    m_RecordableInputs[key_index(newInput)] = true;
+    m_Revision++;
     return *this;
 }
 
-CInputRecorder::CInputRecorder(std::initializer_list<char> recordableInputs) {
+bool CInputRecorder::is_recordable(char input) const {
+    return m_RecordableInputs[key_index(input)];
+}
+
+size_t CInputRecorder::get_revision() const {
+    return m_Revision;
+}
+
+CInputRecorder::CInputRecorder(std::initializer_list<char> recordableInputs)
+        : CInputRecorder() {
     for (char input : recordableInputs)
         add_recordable_input(input);
 }
 
-std::vector<char> CInputRecorder::pop_recorded_inputs() {
-    std::vector<char> resultList = m_RecordedInputs;
-    m_RecordedInputs.clear();
-    return resultList;
+bool CInputRecorder::pop_recorded_input(char& input) {
+    return m_RecordedInputs.read(&input, 1) == 1;
+}
+
+size_t CInputRecorder::key_index(char input) {
+    return static_cast<unsigned char>(input);
 }
 
-CInputRecorder::CInputRecorder() = default;
+CInputRecorder::CInputRecorder()
+        : m_RecordedInputs(CAPACITY), m_RecordableInputs(), m_Revision(0) {}
 
 CInputRecorder::~CInputRecorder() = default;
 
@@ -1,16 +1,25 @@
 #pragma once
 
-#include <unordered_set>
-#include <vector>
+#include "CSpscRing.h"
+#include <array>
 #include <memory>
+#include <chrono>
+#include <cstddef>
 
-/// @brief Stores inputs from keyboard by having a set o available keys,
+/// @brief Stores inputs from keyboard by having a table of available keys,
 ///        that this class considers to be pressed (other keys get ignored).
 ///        This class is then managed by CInputManager, that has a pointer
 ///        to an instance of this class and puts recorded keys into it.
+///        Recorded keys are kept in a ring with a fixed capacity, so recording does not allocate.
 class CInputRecorder {
 public:
     
+    /// Number of keys that can wait in the recorder, keys pressed when it is full are ignored.
+    static constexpr size_t CAPACITY = 64;
+    
+    /// Number of entries of tables indexed by keys (one per byte).
+    static constexpr size_t KEY_COUNT = 256;
+    
     /// CInputRecorder default constructor.
     CInputRecorder();
     
@@ -23,19 +32,40 @@ public:
     
     /// Registers one input. This method is mostly used by CInputManager
     /// @param[in] input Key that was pressed. The key is checked first if
-    ///                  it is in set of recordable inputs and then added.
-    void record_input(char input);
+    ///                  it is in the table of recordable inputs and then added.
+    /// @param[in] time When the key has been read from the terminal.
+    virtual void record_input(char input, std::chrono::steady_clock::time_point time);
     
     /// Add one key that this class should register.
     /// @param[in] newInput Key that we want to detect.
     CInputRecorder& add_recordable_input(char newInput);
     
-    /// @return Vector of pressed keys that are registered.
-    ///         Internal vector of stored pressed keys is then emptied.
-    std::vector<char> pop_recorded_inputs();
+    /// @param[in] input Key to check.
+    /// @return Whether the key is registered by this instance.
+    [[nodiscard]] bool is_recordable(char input) const;
+    
+    /// @return Number that changes every time a key is added, so CInputManager knows
+    ///         when its table of keys is out of date.
+    [[nodiscard]] size_t get_revision() const;
+    
+    /// Takes the oldest pressed key that is registered.
+    /// @param[out] input The key, not changed if there is none.
+    /// @return Whether there was a key.
+    bool pop_recorded_input(char& input);
+
+protected:
+    
+    /// @param[in] input Key.
+    /// @return Index of the key in tables indexed by keys.
+    static size_t key_index(char input);
+
 private:
-    /// Vector of inputs that have been recorded by this instance.
-    std::vector<char> m_RecordedInputs;
-    /// Set of keys that this instance should register.
-    std::unordered_set<char> m_RecordableInputs;
+    /// Ring of inputs that have been recorded by this instance.
+    CSpscRing<char> m_RecordedInputs;
+    
+    /// Table of keys that this instance should register indexed by 'key_index()'.
+    std::array<bool, KEY_COUNT> m_RecordableInputs;
+    
+    /// Number of keys added by 'add_recordable_input()'.
+    size_t m_Revision;
 };
@@ -0,0 +1,49 @@
+#include "CLatencyStatistics.h"
+
+CLatencyStatistics::CLatencyStatistics()
+        : m_Count(0), m_Total(0), m_Maximum(0) {}
+
+void CLatencyStatistics::record(std::chrono::steady_clock::duration duration) {
+    auto nanoseconds = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    m_Count++;
+    m_Total += nanoseconds;
+    if (nanoseconds > m_Maximum)
+        m_Maximum = nanoseconds;
+}
+
+void CLatencyStatistics::reset() {
+    m_Count = 0;
+    m_Total = 0;
+    m_Maximum = 0;
+}
+
+size_t CLatencyStatistics::count() const {
+    return m_Count;
+}
+
+uint64_t CLatencyStatistics::average_microseconds() const {
+    return average_nanoseconds() / 1000;
+}
+
+uint64_t CLatencyStatistics::maximum_microseconds() const {
+    return m_Maximum / 1000;
+}
+
+uint64_t CLatencyStatistics::average_nanoseconds() const {
+    return m_Count == 0 ? 0 : m_Total / m_Count;
+}
+
+uint64_t CLatencyStatistics::maximum_nanoseconds() const {
+    return m_Maximum;
+}
+
+void CLatencyStatistics::print(const std::string& name, std::ostream& os) const {
+    os << " " << name << ": " << average_microseconds() << " us on average, "
+       << maximum_microseconds() << " us at most (" << count() << " samples)" << std::endl;
+}
+
+void CLatencyStatistics::print_nanoseconds(const std::string& name, std::ostream& os) const {
+    os << " " << name << ": " << average_nanoseconds() << " ns on average, "
+       << maximum_nanoseconds() << " ns at most (" << count() << " samples)" << std::endl;
+}
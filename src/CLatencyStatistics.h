@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Collects durations of one stage of the game loop (like simulating a tick or encoding a frame)
+///        and reports their count, average and maximum.
+///        Each instance is only written by the thread running the stage and read after the thread stops.
+class CLatencyStatistics {
+public:
+    
+    /// Default constructor of CLatencyStatistics.
+    CLatencyStatistics();
+    
+    /// Records one duration of the stage.
+    /// @param[in] duration Duration to record.
+    void record(std::chrono::steady_clock::duration duration);
+    
+    /// Forgets all recorded durations.
+    void reset();
+    
+    /// @return Number of recorded durations.
+    [[nodiscard]] size_t count() const;
+    
+    /// @return Average of the recorded durations in microseconds (0 if nothing was recorded).
+    [[nodiscard]] uint64_t average_microseconds() const;
+    
+    /// @return Maximum of the recorded durations in microseconds.
+    [[nodiscard]] uint64_t maximum_microseconds() const;
+    
+    /// @return Average of the recorded durations in nanoseconds (0 if nothing was recorded).
+    [[nodiscard]] uint64_t average_nanoseconds() const;
+    
+    /// @return Maximum of the recorded durations in nanoseconds.
+    [[nodiscard]] uint64_t maximum_nanoseconds() const;
+    
+    /// Prints one line with the name of the stage and its statistics.
+    /// @param[in] name Name of the stage.
+    /// @param[in, out] os Stream to print into.
+    void print(const std::string& name, std::ostream& os) const;
+    
+    /// Prints one line with the name of the stage and its statistics in nanoseconds,
+    /// for stages that usually take less than a microsecond.
+    /// @param[in] name Name of the stage.
+    /// @param[in, out] os Stream to print into.
+    void print_nanoseconds(const std::string& name, std::ostream& os) const;
+
+private:
+    
+    /// Number of recorded durations.
+    size_t m_Count;
+    
+    /// Sum of the recorded durations in nanoseconds.
+    uint64_t m_Total;
+    
+    /// Maximum of the recorded durations in nanoseconds.
+    uint64_t m_Maximum;
+};
@@ -1,11 +1,11 @@
 #include "CLoopFollowerAi.h"
 
 std::shared_ptr<CEnemyAi> CLoopFollowerAi::clone() const {
-    return std::make_shared<CLoopFollowerAi>(*this);
+    return CPoolAllocator<CLoopFollowerAi>::make_shared(*this);
 }
 
 std::shared_ptr<CFollowerAi> CLoopFollowerAi::clone_as_follower() const {
-    return std::make_shared<CLoopFollowerAi>(*this);
+    return CPoolAllocator<CLoopFollowerAi>::make_shared(*this);
 }
 
 Direction::EDirection CLoopFollowerAi::decide_direction(const CPosition& startPosition, const CPosition& targetPosition,
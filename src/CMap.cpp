@@ -1,63 +1,70 @@
 #include "CMap.h"
 
-CMap::CMap() = default;
+CMap::CMap()
+        : CMap(std::make_shared<CWorldMap>(), Layer::ENVIRONMENT) {}
 
-CMap::CMap(std::initializer_list<std::shared_ptr<CObject>> objects) {
+CMap::CMap(std::initializer_list<std::shared_ptr<CObject>> objects)
+        : CMap() {
     for (const auto& object: objects)
         add_object(object);
 }
 
+CMap::CMap(const std::shared_ptr<CWorldMap>& world, Layer::ELayer layer)
+        : m_World(world), m_Layer(layer) {}
+
 CMap& CMap::add_object(const std::shared_ptr<CObject>& object) {
-    m_Map[object->get_position()] = object;
+    m_World->add_object(m_Layer, object);
     return *this;
 }
 
+std::shared_ptr<CObject> CMap::object_at(const CPosition& position) const {
+    return m_World->object_at(m_Layer, position);
+}
+
+CHandle CMap::handle_at(const CPosition& position) const {
+    return m_World->handle_at(m_Layer, position);
+}
+
+std::shared_ptr<CObject> CMap::get_object(CHandle handle) const {
+    return m_World->get_object(handle);
+}
+
 bool CMap::can_be_stepped_on(const CPosition& position) const {
-    auto candidateIt = m_Map.find(position);
-    return candidateIt == m_Map.end() || candidateIt->second->can_be_stepped_on();
+    return !(m_World->blocking_layers_at(position) & Layer::mask_of(m_Layer));
 }
 
 void CMap::update_position_of_object_at(const CPosition& position) {
-    std::shared_ptr<CObject> object = m_Map.at(position);
-    if (object->get_position() != position) {
-        m_Map.erase(position);
-        add_object(object);
-    }
+    m_World->update_position_of_object_at(m_Layer, position);
 }
 
 bool CMap::erase_object_at(const CPosition& position) {
-    return m_Map.erase(position);
+    return m_World->erase_object_at(m_Layer, position);
 }
 
 void CMap::erase_object(const std::shared_ptr<CObject>& object) {
-    auto it = m_Map.find(object->get_position());
-    if (it != m_Map.end() && it->second == object) {
-        erase_object_at(object->get_position());
-    }
+    m_World->erase_object(m_Layer, object);
 }
 
 void CMap::push_objects_to_render(CRenderer& renderer) const {
-    for (const auto& [key, object]: m_Map)
-        renderer.prepare_to_render(*object);
+    m_World->push_objects_to_render(m_Layer, renderer);
 }
 
 bool CMap::is_empty_at(const CPosition& position) const {
-    return m_Map.find(position) == m_Map.end();
+    return !(m_World->occupied_layers_at(position) & Layer::mask_of(m_Layer));
 }
 
 bool CMap::try_dealing_damage_at(int damagePoints, const CPosition& position, const CObject* exception) {
-    auto candidateIt = m_Map.find(position);
-    if (candidateIt == m_Map.end() || candidateIt->second.get() == exception)
-        return false;
-    if (candidateIt->second->deal_damage(damagePoints))
-        erase_object(candidateIt->second);
-    return true;
+    return m_World->try_dealing_damage_at(Layer::mask_of(m_Layer), damagePoints, position, exception);
 }
 
-void CMap::update_looks_all_objects() {
-    for (auto& object : m_Map)
-        object.second->update_looks();
+std::vector<std::shared_ptr<CObject>> CMap::nearest_objects(const CPosition& center, size_t count) const {
+    return m_World->nearest_objects(m_Layer, center, count);
 }
 
+const std::shared_ptr<CWorldMap>& CMap::get_world() const {
+    return m_World;
+}
 
-
+Layer::ELayer CMap::get_layer() const {
+    return m_Layer;
+}
@@ -3,15 +3,20 @@
 #include "CObject.h"
 #include "CPosition.h"
 #include "CRenderer.h"
-#include <map>
+#include "CWorldMap.h"
+#include "ELayer.h"
 #include <memory>
+#include <vector>
 
 /// @brief Class for looking up objects by their positions.
 ///        This class is then used mostly for collision detection.
+///        CMap is a view of one layer of CWorldMap - multiple CMaps can share the same world,
+///        so they can be queried together (see CMapJoin) using the layer bitmasks of the world.
 class CMap {
 public:
     
     /// Default constructor of CMap.
+    /// The map creates its own world and uses its ENVIRONMENT layer.
     CMap();
     
     /// Constructor that registers list of objects by their position.
@@ -19,12 +24,30 @@ public:
     /// @param[in] objects Objects to be added.
     CMap(std::initializer_list<std::shared_ptr<CObject>> objects);
     
+    /// Constructor of CMap as a view of one layer of an existing world.
+    /// @param[in] world World that the objects are stored in.
+    /// @param[in] layer Layer of the world that this map represents.
+    CMap(const std::shared_ptr<CWorldMap>& world, Layer::ELayer layer);
+    
     /// Registers new object using its position.
     /// @param[in] object Object to be added.
     /// @return Reference to '*this' for chaining calls of this method.
     /// @warning If there is already an object at that position, it will get overwritten by the new object.
     CMap& add_object(const std::shared_ptr<CObject>& object);
     
+    /// @param[in] position Position to look at.
+    /// @return Pointer to the object at %position (nullptr if there is none).
+    [[nodiscard]] std::shared_ptr<CObject> object_at(const CPosition& position) const;
+    
+    /// @param[in] position Position to look at.
+    /// @return Handle to the object at %position (null handle if there is none).
+    ///         The handle stays valid while the object moves and becomes stale once the object is erased.
+    [[nodiscard]] CHandle handle_at(const CPosition& position) const;
+    
+    /// @param[in] handle Handle to an object (see 'handle_at()').
+    /// @return Pointer to the object or nullptr if the handle is stale.
+    [[nodiscard]] std::shared_ptr<CObject> get_object(CHandle handle) const;
+    
     /// Method for checking if there is an object at some position and
     /// if there is, its 'can_be_stepped_on()' method will be called.
     /// @param[in] position Position we want to check.
@@ -61,11 +84,22 @@ public:
     /// Puts all contained objects into renderer to be rendered later.
     void push_objects_to_render(CRenderer& renderer) const;
     
-    /// Calls 'update_looks()' method on all object in this container.
-    void update_looks_all_objects();
+    /// @param[in] center Position to measure the distance from.
+    /// @param[in] count Maximum number of objects to return.
+    /// @return Up to %count objects in this container closest to %center, the closest one first.
+    [[nodiscard]] std::vector<std::shared_ptr<CObject>> nearest_objects(const CPosition& center, size_t count) const;
+    
+    /// @return World that the objects of this map are stored in.
+    [[nodiscard]] const std::shared_ptr<CWorldMap>& get_world() const;
+    
+    /// @return Layer of the world that this map represents.
+    [[nodiscard]] Layer::ELayer get_layer() const;
 
 private:
     
-    /// Internal representation of CMap - map of positions and shared pointers.
-    std::map<CPosition, std::shared_ptr<CObject>> m_Map;
+    /// World that the objects of this map are stored in.
+    std::shared_ptr<CWorldMap> m_World;
+    
+    /// Layer of the world that this map represents.
+    Layer::ELayer m_Layer;
 };
@@ -1,28 +1,53 @@
 #include "CMapJoin.h"
 
 CMapJoin::CMapJoin(std::initializer_list<std::shared_ptr<CMap>> maps)
-        : m_Maps(maps) {}
+        : m_World(nullptr), m_Layers(0) {
+    for (auto& map: maps) {
+        if (m_World != nullptr && m_World != map->get_world().get()) {
+            throw std::invalid_argument("joined maps have to share the same world");
+        }
+        m_World = map->get_world().get();
+        m_Layers |= Layer::mask_of(map->get_layer());
+    }
+}
+
+CMapJoin::CMapJoin(const std::shared_ptr<CWorldMap>& world, Layer::LayerMask layers)
+        : m_World(world.get()), m_Layers(layers) {}
 
 bool CMapJoin::can_be_stepped_on(const CPosition& position) const {
-    for (auto& map: m_Maps) {
-        if (!map->can_be_stepped_on(position)) return false;
-    }
-    return true;
+    return m_World == nullptr || !(m_World->blocking_layers_at(position) & m_Layers);
 }
 
 bool CMapJoin::is_empty_at(const CPosition& position) const {
-    for (auto& map: m_Maps) {
-        if (!map->is_empty_at(position)) return false;
-    }
-    return true;
+    return m_World == nullptr || !(m_World->occupied_layers_at(position) & m_Layers);
 }
 
 bool CMapJoin::try_dealing_damage_at(int damagePoints, const CPosition& position, const CObject* exception) const {
-    bool wasDamageDealt = false;
-    for (auto& map: m_Maps) {
-        if (map->try_dealing_damage_at(damagePoints, position, exception))
-            wasDamageDealt = true;
-    }
-    return wasDamageDealt;
+    return m_World != nullptr && m_World->try_dealing_damage_at(m_Layers, damagePoints, position, exception);
 }
 
+uint32_t CMapJoin::free_neighbours(const CPosition& position) const {
+    if (m_World == nullptr)
+        return (1u << Direction::DIRECTION_COUNT) - 1;
+    return m_World->free_neighbours(m_Layers, position);
+}
+
+int CMapJoin::first_blocker(const CPosition& from, Direction::EDirection direction, int maxDistance) const {
+    if (m_World == nullptr)
+        return -1;
+    return m_World->first_blocker(m_Layers, from, direction, maxDistance);
+}
+
+std::optional<CPosition> CMapJoin::raycast(const CPosition& from, Direction::EDirection direction,
+                                           int maxDistance) const {
+    if (m_World == nullptr)
+        return std::nullopt;
+    return m_World->raycast(from, direction, maxDistance, m_Layers);
+}
+
+Direction::EDirection CMapJoin::direction_of_sight(const CPosition& position, const CPosition& target,
+                                                   int range) const {
+    if (m_World == nullptr)
+        return Direction::NONE;
+    return m_World->direction_of_sight(position, target, range);
+}
@@ -1,18 +1,29 @@
 #pragma once
 
 #include "CMap.h"
+#include "CWorldMap.h"
+#include "ELayer.h"
 #include <memory>
-#include <list>
+#include <optional>
+#include <stdexcept>
 
 /// @brief Class that enables joining multiple instances CMap pointers to one and
 ///        calling some methods on all of them at once.
+///        All joined maps have to share the same CWorldMap - the join is then just a bitmask
+///        of their layers and every query is answered by one lookup in the world.
 class CMapJoin {
 public:
     
     /// Constructor of CMapJoin.
     /// @param[in] maps List of CMaps that we are supposed to be stored in CMapJoin.
+    /// @throws std::invalid_argument if the maps are not views of the same world.
     CMapJoin(std::initializer_list<std::shared_ptr<CMap>> maps);
     
+    /// Constructor of CMapJoin from a world and a bitmask of its layers.
+    /// @param[in] world World that the joined layers belong to.
+    /// @param[in] layers Bitmask of the joined layers.
+    CMapJoin(const std::shared_ptr<CWorldMap>& world, Layer::LayerMask layers);
+    
     /// Method for calling 'can_be_stepped_on()' on all CMaps.
     /// @return True if any of the maps return true to their 'can_be_stepped_on()' method.
     ///         Otherwise false.
@@ -28,8 +39,31 @@ public:
     ///         Otherwise false.
     bool try_dealing_damage_at(int damagePoints, const CPosition& position, const CObject* exception = nullptr) const;
 
+    /// Tests the cell at %position and its four neighbours at once (see CWorldMap::free_neighbours()).
+    /// @return Bitmask indexed by Direction::EDirection - bit D is set when the cell 'position + D' can be stepped on.
+    [[nodiscard]] uint32_t free_neighbours(const CPosition& position) const;
+    
+    /// Finds the closest cell that cannot be stepped on along a row or a column (see CWorldMap::first_blocker()).
+    /// @return Distance to the closest blocking cell or -1 if there is none within %maxDistance.
+    [[nodiscard]] int first_blocker(const CPosition& from, Direction::EDirection direction, int maxDistance) const;
+
+    /// Casts a ray along a row or a column (see CWorldMap::raycast()).
+    /// @return Position where the ray got stopped or std::nullopt if it did not hit anything.
+    [[nodiscard]] std::optional<CPosition> raycast(const CPosition& from, Direction::EDirection direction,
+                                                   int maxDistance) const;
+    
+    /// Finds out whether %target can be seen from %position through the walls of the world
+    /// (see CWorldMap::direction_of_sight()).
+    /// @return Direction in which %target is seen or Direction::NONE if it cannot be seen.
+    [[nodiscard]] Direction::EDirection direction_of_sight(const CPosition& position, const CPosition& target,
+                                                           int range) const;
+
 private:
     
-    /// List of pointers to CMaps stored in this CMapJoin.
-    std::list<std::shared_ptr<CMap>> m_Maps;
+    /// World that the joined maps are views of (nullptr when no maps are joined).
+    /// The join is a short-lived view, so it does not take part in the ownership of the world.
+    CWorldMap* m_World;
+    
+    /// Bitmask of the joined layers.
+    Layer::LayerMask m_Layers;
 };
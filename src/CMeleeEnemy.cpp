@@ -6,7 +6,7 @@ CMeleeEnemy::CMeleeEnemy(const std::shared_ptr<CMovableObject>& object, const CE
 
 bool
 CMeleeEnemy::inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                          const CMapJoin& environment, std::list<CBullet>& bullets,
+                          const CMapJoin& environment, CBulletStore& bullets,
                           const std::shared_ptr<CMap>& bulletMap) {
     
     // If the %action is ATTACK, try to attack the player.
@@ -19,7 +19,7 @@ CMeleeEnemy::inner_update(Action::EAction action, CObject& player, const std::sh
         
         if (supposedPlayerPosition == player.get_position()) {
             // Player is in the direction the enemy is looking and close enough -> deal damage.
-            player.deal_damage(m_Damage);
+            player.deal_damage(m_Damage, mapContainingObject->get_world()->get_hurt_objects());
         }
     }
     
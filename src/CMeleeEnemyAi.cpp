@@ -1,7 +1,7 @@
 #include "CMeleeEnemyAi.h"
 
 std::shared_ptr<CEnemyAi> CMeleeEnemyAi::clone() const {
-    return std::make_shared<CMeleeEnemyAi>(*this);
+    return CPoolAllocator<CMeleeEnemyAi>::make_shared(*this);
 }
 
 Action::EAction CMeleeEnemyAi::decide_action(const CPosition& startPosition, const CPosition& targetPosition,
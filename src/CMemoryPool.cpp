@@ -0,0 +1,91 @@
+#include "CMemoryPool.h"
+#include <new>
+#include <algorithm>
+#include <cassert>
+
+CMemoryPool::CMemoryPool(std::string name, size_t blockSize, size_t blockAlignment)
+        : m_Name(std::move(name)),
+          m_BlockAlignment(std::max(blockAlignment, alignof(void*))),
+          m_FreeList(nullptr),
+          m_InUse(0),
+          m_HighWaterMark(0),
+          m_OwnerThread(std::this_thread::get_id()) {
+    // Round the size up, so every block in a chunk is aligned.
+    size_t size = std::max(blockSize, sizeof(void*));
+    m_BlockSize = (size + m_BlockAlignment - 1) / m_BlockAlignment * m_BlockAlignment;
+    registry().push_back(this);
+}
+
+CMemoryPool::~CMemoryPool() {
+    auto& pools = registry();
+    pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+    for (void* chunk: m_Chunks)
+        ::operator delete(chunk, std::align_val_t(m_BlockAlignment));
+}
+
+void* CMemoryPool::allocate() {
+    assert(std::this_thread::get_id() == m_OwnerThread && "memory pools are not thread-safe");
+    if (m_FreeList == nullptr)
+        grow();
+    
+    // Pop the first free block.
+    void* block = m_FreeList;
+    m_FreeList = *static_cast<void**>(block);
+    
+    m_InUse++;
+    m_HighWaterMark = std::max(m_HighWaterMark, m_InUse);
+    return block;
+}
+
+void CMemoryPool::deallocate(void* block) {
+    assert(std::this_thread::get_id() == m_OwnerThread && "memory pools are not thread-safe");
+    // Push the block at the beginning of the free list, so it is the first one to be reused.
+    *static_cast<void**>(block) = m_FreeList;
+    m_FreeList = block;
+    m_InUse--;
+}
+
+size_t CMemoryPool::in_use() const {
+    return m_InUse;
+}
+
+size_t CMemoryPool::high_water_mark() const {
+    return m_HighWaterMark;
+}
+
+size_t CMemoryPool::capacity() const {
+    return m_Chunks.size() * BLOCKS_PER_CHUNK;
+}
+
+void CMemoryPool::reset_high_water_marks() {
+    for (CMemoryPool* pool: registry())
+        pool->m_HighWaterMark = pool->m_InUse;
+}
+
+void CMemoryPool::print_statistics(std::ostream& os) {
+    for (const CMemoryPool* pool: registry()) {
+        if (pool->capacity() == 0)
+            continue;
+        os << " " << pool->m_Name << ": " << pool->m_HighWaterMark << " at most in use ("
+           << pool->capacity() << " allocated)" << std::endl;
+    }
+}
+
+void CMemoryPool::grow() {
+    char* chunk = static_cast<char*>(::operator new(m_BlockSize * BLOCKS_PER_CHUNK,
+                                                    std::align_val_t(m_BlockAlignment)));
+    m_Chunks.push_back(chunk);
+    
+    // Link the new blocks in the order of their addresses, so they get used in that order.
+    for (size_t i = BLOCKS_PER_CHUNK; i-- > 0;) {
+        void* block = chunk + i * m_BlockSize;
+        *static_cast<void**>(block) = m_FreeList;
+        m_FreeList = block;
+    }
+}
+
+std::vector<CMemoryPool*>& CMemoryPool::registry() {
+    // The registry is never destroyed, so pools can unregister themselves during static destruction.
+    static auto* pools = new std::vector<CMemoryPool*>();
+    return *pools;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstddef>
+#include <thread>
+
+/// @brief Recycling pool of memory blocks of one size.
+///        Freed blocks are kept in an intrusive free list and handed out again by the next allocation,
+///        so once the pool has grown to the number of blocks the game needs at once,
+///        allocations and frees do not touch the heap at all. Blocks are allocated from the heap
+///        in chunks and are never returned to it.
+///        All pools register themselves, so their statistics can be reported (see 'print_statistics()').
+///        Pools are not thread-safe - a pool may only be used by the thread that created it (the game thread),
+///        which is checked by assertions. Other threads (input, rendering) must not allocate pooled objects
+///        or drop the last reference to them.
+class CMemoryPool {
+public:
+    
+    /// Number of blocks allocated from the heap at once when the pool runs out of free blocks.
+    static constexpr size_t BLOCKS_PER_CHUNK = 64;
+    
+    /// Constructor of CMemoryPool.
+    /// @param[in] name Name of the pool used in reports.
+    /// @param[in] blockSize Size of one block in bytes.
+    /// @param[in] blockAlignment Required alignment of the blocks.
+    CMemoryPool(std::string name, size_t blockSize, size_t blockAlignment);
+    
+    /// Pools hand out raw memory, so they cannot be copied.
+    CMemoryPool(const CMemoryPool& other) = delete;
+    
+    /// Pools hand out raw memory, so they cannot be copied.
+    CMemoryPool& operator=(const CMemoryPool& other) = delete;
+    
+    /// Destructor of CMemoryPool. Returns all chunks to the heap.
+    ~CMemoryPool();
+    
+    /// @return Pointer to a block of memory of the pool's block size.
+    void* allocate();
+    
+    /// Returns a block into the pool.
+    /// @param[in] block Block previously returned by 'allocate()' of this pool.
+    void deallocate(void* block);
+    
+    /// @return Number of blocks that are currently in use.
+    [[nodiscard]] size_t in_use() const;
+    
+    /// @return Maximum number of blocks that have been in use at once since the last reset.
+    [[nodiscard]] size_t high_water_mark() const;
+    
+    /// @return Number of blocks owned by the pool (used or free).
+    [[nodiscard]] size_t capacity() const;
+    
+    /// Sets high-water marks of all pools to the number of blocks they currently use.
+    static void reset_high_water_marks();
+    
+    /// Prints name, high-water mark and capacity of every pool that has been used.
+    /// @param[out] os Stream to print into.
+    static void print_statistics(std::ostream& os);
+
+private:
+    
+    /// Allocates a new chunk of blocks and puts them into the free list.
+    void grow();
+    
+    /// @return Registry of all pools.
+    static std::vector<CMemoryPool*>& registry();
+    
+    /// Name of the pool used in reports.
+    std::string m_Name;
+    
+    /// Size of one block in bytes (at least the size of a pointer, so a free block can hold the free list link).
+    size_t m_BlockSize;
+    
+    /// Required alignment of the blocks.
+    size_t m_BlockAlignment;
+    
+    /// First free block. Each free block stores a pointer to the next free block.
+    void* m_FreeList;
+    
+    /// Chunks of blocks allocated from the heap.
+    std::vector<void*> m_Chunks;
+    
+    /// Number of blocks that are currently in use.
+    size_t m_InUse;
+    
+    /// Maximum number of blocks that have been in use at once since the last reset.
+    size_t m_HighWaterMark;
+    
+    /// Thread that created the pool, the only one allowed to use it.
+    std::thread::id m_OwnerThread;
+};
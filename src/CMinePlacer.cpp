@@ -6,7 +6,7 @@ CMinePlacer::CMinePlacer(std::string name, const CBulletObjectBuilder& bulletBui
                          bool infiniteAmmo, bool doubleBullets)
         : CGun(std::move(name), bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, doubleBullets) {}
 
-void CMinePlacer::shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
+void CMinePlacer::shoot(CBulletStore& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
                         const CPosition& positionOfShooting, const CMapJoin& environment,
                         VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) {
     if (!can_shoot()) return;
@@ -26,12 +26,12 @@ void CMinePlacer::shoot(std::list<CBullet>& bulletControllers, const std::shared
     auto bullet =
             m_BulletBuilder.build_bullet(minePosition, vOrientation, hOrientation, m_DoubleBullets);
     bulletMap->add_object(bullet);
-    bulletControllers.emplace_back(bullet, Direction::NONE, -1);
+    bulletControllers.emplace(bullet, Direction::NONE, -1);
     
     decrement_ammo();
     m_FireRateTicks.reset();
 }
 
 std::shared_ptr<CGun> CMinePlacer::clone() const {
-    return std::make_shared<CMinePlacer>(*this);
+    return CPoolAllocator<CMinePlacer>::make_shared(*this);
 }
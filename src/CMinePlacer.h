@@ -17,12 +17,12 @@ public:
                 bool infiniteAmmo = false, bool doubleBullets = false);
     
     /// Places mine (stationary bullet).
-    /// @param[in, out] bullets List of bullets in the game so the mine placer can add the mine into in.
+    /// @param[in, out] bullets Container of bullets in the game so the mine placer can add the mine into in.
     /// @param[in, out] bulletMap CMap containing bullet objects in the game so the mine placer can add the mine into in.
     /// @param[in, out] positionOfShooting Position where the entity holding the mine placer currently is.
     /// @param[in, out] vOrientation VERTICAL orientation of entity holding the mine placer.
     /// @param[in, out] hOrientation HORIZONTAL orientation of entity holding the mine placer.
-    void shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
+    void shoot(CBulletStore& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
                const CPosition& positionOfShooting, const CMapJoin& environment,
                VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) override;
     
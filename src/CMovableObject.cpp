@@ -7,6 +7,13 @@ CMovableObject::CMovableObject(const CPosition& position, int maxHeathPoints, co
           m_HOrientation(HOrientation::LEFT),
           m_MultipleSprites(false) {}
 
+CMovableObject::CMovableObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite,
+                               bool canBeSteppedOn)
+        : CObject(position, maxHeathPoints, sprite, canBeSteppedOn),
+          m_VOrientation(VOrientation::UP),
+          m_HOrientation(HOrientation::LEFT),
+          m_MultipleSprites(false) {}
+
 void CMovableObject::update_sprite(Direction::EDirection move) {
     
     // Update object's orientation
@@ -69,11 +76,13 @@ void CMovableObject::setup_sprites(const std::list<CVisualBlock>& sprites) {
     // %m_Sprites contains 6 sprites for different directions the object can move in.
     // After setup, we can look up objects sprites by %m_Sprites[HORIZONTAL_ORIENTATION][VERTICAL_ORIENTATION].
     // ( %m_Sprites essentially work like 2D map ).
-    m_Sprites = std::vector<std::vector<CVisualBlock>>(HORIZONTAL_DIRECTION_COUNT, std::vector<CVisualBlock>());
+    m_Sprites = std::vector<std::vector<CSpritePalette::SpriteId>>(HORIZONTAL_DIRECTION_COUNT,
+                                                                  std::vector<CSpritePalette::SpriteId>());
+    std::vector<CSpritePalette::SpriteId> spriteIds = CSpritePalette::intern_all(sprites);
     
-    switch (sprites.size()) {
+    switch (spriteIds.size()) {
         case 1:
-            m_Sprite = sprites.front();
+            m_Sprite = spriteIds.front();
             m_MultipleSprites = false;
             break;
             
@@ -83,7 +92,7 @@ void CMovableObject::setup_sprites(const std::list<CVisualBlock>& sprites) {
         case HORIZONTAL_DIRECTION_COUNT: {
             int cnt = 0;
             for (int i = 0; i < VERTICAL_DIRECTION_COUNT; ++i) {
-                for (auto& sprite: sprites) {
+                for (auto sprite: spriteIds) {
                     m_Sprites[cnt++ % HORIZONTAL_DIRECTION_COUNT].push_back(sprite);
                 }
             }
@@ -95,7 +104,7 @@ void CMovableObject::setup_sprites(const std::list<CVisualBlock>& sprites) {
         case VERTICAL_DIRECTION_COUNT: {
             int cnt = 0;
             for (int i = 0; i < HORIZONTAL_DIRECTION_COUNT; ++i) {
-                for (auto& sprite: sprites) {
+                for (auto sprite: spriteIds) {
                     m_Sprites[cnt++ / VERTICAL_DIRECTION_COUNT].push_back(sprite);
                 }
             }
@@ -106,7 +115,7 @@ void CMovableObject::setup_sprites(const std::list<CVisualBlock>& sprites) {
             // We simply take each sprite and add it to %m_Sprites.
         case VERTICAL_DIRECTION_COUNT * HORIZONTAL_DIRECTION_COUNT: {
             int cnt = 0;
-            for (auto& sprite: sprites) {
+            for (auto sprite: spriteIds) {
                 m_Sprites[cnt++ % HORIZONTAL_DIRECTION_COUNT].push_back(sprite);
             }
             break;
@@ -115,5 +124,7 @@ void CMovableObject::setup_sprites(const std::list<CVisualBlock>& sprites) {
         default:
             throw std::invalid_argument("num of sprites");
     }
-    m_Sprite = m_Sprites[m_HOrientation][m_VOrientation];
+    if (m_MultipleSprites) {
+        m_Sprite = m_Sprites[m_HOrientation][m_VOrientation];
+    }
 }
@@ -22,6 +22,15 @@ public:
     /// @param[in] canBeSteppedOn Whether entities can step on this object or not;
     CMovableObject(const CPosition& position, int maxHeathPoints, const CVisualBlock& sprite, bool canBeSteppedOn);
     
+    /// Constructor of CMovableObject.
+    /// @param[in] position Starting position of the object.
+    /// @param[in] maxHeathPoints Maximum health points of the object.
+    ///                           Actual health points are set to this number as well.
+    /// @param[in] sprite Looks of the object already interned in CSpritePalette.
+    /// @param[in] canBeSteppedOn Whether entities can step on this object or not;
+    CMovableObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite,
+                   bool canBeSteppedOn);
+    
     
     /// Constructor of CMovableObject.
     /// @param[in] position Starting position of the object.
@@ -67,7 +76,7 @@ public:
 
 protected:
     
-    /// Preprocesses and stores sprites into %m_Sprites depending on the length of %sprites.
+    /// Preprocesses, interns and stores sprites into %m_Sprites depending on the length of %sprites.
     /// @param[in] sprites List of sprites - if the object is moved, it can change it's looks
     ///                    to simulate changing it's 'orientation' by changing it's sprite.
     ///                    Possible lists:
@@ -86,7 +95,7 @@ protected:
     
     /// 2D vector of 6 sprites total for different orientations of the object.
     /// The lookup from this vector is done using %m_VOrientation and %m_HOrientation.
-    std::vector<std::vector<CVisualBlock>> m_Sprites;
+    std::vector<std::vector<CSpritePalette::SpriteId>> m_Sprites;
     
     /// Whether object has distinct sprites for moving into different directions or not.
     bool m_MultipleSprites;
@@ -33,6 +33,10 @@ CNonStaticEntity& CNonStaticEntity::operator=(const CNonStaticEntity& other) {
     return *this;
 }
 
+CNonStaticEntity::CNonStaticEntity(CNonStaticEntity&& other) noexcept = default;
+
+CNonStaticEntity& CNonStaticEntity::operator=(CNonStaticEntity&& other) noexcept = default;
+
 CNonStaticEntity::~CNonStaticEntity() = default;
 
 
@@ -24,6 +24,14 @@ public:
     /// @return A reference to *this.
     CNonStaticEntity& operator=(const CNonStaticEntity& other);
     
+    /// Move constructor. Unlike the copy constructor, it takes over the object instead of cloning it,
+    /// so entities can be relocated inside of containers (see CEnemyStore) without leaving the maps behind.
+    CNonStaticEntity(CNonStaticEntity&& other) noexcept;
+    
+    /// Move operator= taking over the object of %other.
+    /// @return A reference to *this.
+    CNonStaticEntity& operator=(CNonStaticEntity&& other) noexcept;
+    
     /// Virtual destructor since this is a base class of polymorphic hierarchy.
     virtual ~CNonStaticEntity();
     
@@ -0,0 +1,46 @@
+#include "CNullBackend.h"
+
+bool CNullBackend::is_interactive() const {
+    return false;
+}
+
+bool CNullBackend::wait_for_size(int width, int height) {
+    static_cast<void>(width);
+    static_cast<void>(height);
+    return false;
+}
+
+void CNullBackend::game_mode_on() {}
+
+void CNullBackend::reset() {}
+
+size_t CNullBackend::read_input(char* buffer, size_t capacity) {
+    static_cast<void>(buffer);
+    static_cast<void>(capacity);
+    return 0;
+}
+
+void CNullBackend::wait_for_input() {
+    m_InputInterrupted.wait();
+}
+
+void CNullBackend::interrupt_input_wait() {
+    m_InputInterrupted.notify();
+}
+
+void CNullBackend::wait_for_event(std::chrono::steady_clock::time_point deadline) {
+    if (deadline != std::chrono::steady_clock::time_point::max())
+        std::this_thread::sleep_until(deadline);
+}
+
+void CNullBackend::notify_event() {}
+
+bool CNullBackend::take_resize() {
+    return false;
+}
+
+bool CNullBackend::write(const char* data, size_t size) {
+    static_cast<void>(data);
+    static_cast<void>(size);
+    return true;
+}
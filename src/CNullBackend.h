@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CTerminalBackend.h"
+#include "CWakeupSignal.h"
+#include <thread>
+
+/// @brief Backend without any terminal. Frames are dropped, no key is ever pressed and every level fits,
+///        so the whole game loop can run in benchmarks or without a terminal attached (for example in CI).
+class CNullBackend : public CTerminalBackend {
+public:
+    
+    /// @return False, nobody watches the game.
+    [[nodiscard]] bool is_interactive() const override;
+    
+    /// Does nothing, any level fits.
+    /// @param[in] width Minimal width of the terminal required.
+    /// @param[in] height Minimal height of the terminal required.
+    /// @return False.
+    bool wait_for_size(int width, int height) override;
+    
+    /// Does nothing.
+    void game_mode_on() override;
+    
+    /// Does nothing.
+    void reset() override;
+    
+    /// No key is ever pressed.
+    /// @param[out] buffer Memory the characters would be read into.
+    /// @param[in] capacity Size of %buffer.
+    /// @return Always 0.
+    size_t read_input(char* buffer, size_t capacity) override;
+    
+    /// Sleeps until 'interrupt_input_wait()' gets called, no key is ever pressed.
+    void wait_for_input() override;
+    
+    /// Wakes up 'wait_for_input()'.
+    void interrupt_input_wait() override;
+    
+    /// Sleeps until %deadline, no key can wake it up. Returns right away if there is no deadline,
+    /// since nothing would ever end the wait.
+    /// @param[in] deadline When to stop waiting.
+    void wait_for_event(std::chrono::steady_clock::time_point deadline) override;
+    
+    /// Does nothing, there are no keys to wake up 'wait_for_event()' for.
+    void notify_event() override;
+    
+    /// @return False, there is nothing to resize.
+    bool take_resize() override;
+    
+    /// Drops the bytes.
+    /// @param[in] data Bytes to write.
+    /// @param[in] size Number of bytes to write.
+    /// @return True.
+    bool write(const char* data, size_t size) override;
+
+private:
+    
+    /// Wakes up 'wait_for_input()'.
+    CWakeupSignal m_InputInterrupted;
+};
@@ -1,33 +1,64 @@
 #include "CObject.h"
 
 
-CObject::CObject(const CPosition& position, int maxHeathPoints, CVisualBlock sprite, bool canBeSteppedOn)
+CObject::CObject(const CPosition& position, int maxHeathPoints, const CVisualBlock& sprite, bool canBeSteppedOn)
+        : CObject(position, maxHeathPoints, CSpritePalette::intern(sprite), canBeSteppedOn) {}
+
+CObject::CObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite, bool canBeSteppedOn)
         : m_Position(position),
-          m_Sprite(std::move(sprite)),
+          m_Sprite(sprite),
           m_MaxHealthPoints(maxHeathPoints),
           m_HealthPoints(m_MaxHealthPoints),
           m_CanBeSteppedOn(canBeSteppedOn),
-          m_DamageTicks(10),
-          m_IsHurt(false) {}
+          m_HurtObjects(nullptr),
+          m_HurtExpiryTick(0) {}
+
+CObject::CObject(const CObject& other)
+        : m_Position(other.m_Position),
+          m_Sprite(other.m_Sprite),
+          m_MaxHealthPoints(other.m_MaxHealthPoints),
+          m_HealthPoints(other.m_HealthPoints),
+          m_CanBeSteppedOn(other.m_CanBeSteppedOn),
+          m_HurtObjects(nullptr),
+          m_HurtExpiryTick(0) {}
+
+CObject& CObject::operator=(const CObject& other) {
+    if (this == &other) return *this;
+    if (m_HurtObjects != nullptr)
+        m_HurtObjects->remove(this, m_HurtExpiryTick);
+    m_Position = other.m_Position;
+    m_Sprite = other.m_Sprite;
+    m_MaxHealthPoints = other.m_MaxHealthPoints;
+    m_HealthPoints = other.m_HealthPoints;
+    m_CanBeSteppedOn = other.m_CanBeSteppedOn;
+    m_HurtObjects = nullptr;
+    return *this;
+}
 
 CPosition CObject::get_position() const {
     return m_Position;
 }
 
-bool CObject::deal_damage(int damagePoints) {
-    m_IsHurt = true;
-    m_DamageTicks.reset();
+bool CObject::deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects) {
+    show_as_hurt(hurtObjects);
     m_HealthPoints -= damagePoints;
     return is_destroyed();
 }
 
-CVisualBlock CObject::get_sprite() const {
-    if (!m_IsHurt)
-        return m_Sprite;
-    
-    CVisualBlock damagedSprite = m_Sprite;
-    damagedSprite.m_BackgroundColor = Color::RED;
-    return damagedSprite;
+void CObject::show_as_hurt(CHurtObjectsRegistry& hurtObjects) {
+    // Re-register the object, so its damage indication lasts from now on.
+    if (m_HurtObjects != nullptr)
+        m_HurtObjects->remove(this, m_HurtExpiryTick);
+    m_HurtExpiryTick = hurtObjects.add(this);
+    m_HurtObjects = &hurtObjects;
+}
+
+const CVisualBlock& CObject::get_sprite() const {
+    return CSpritePalette::get(get_sprite_id());
+}
+
+CSpritePalette::SpriteId CObject::get_sprite_id() const {
+    return m_HurtObjects != nullptr ? CSpritePalette::hurt_variant(m_Sprite) : m_Sprite;
 }
 
 bool CObject::is_destroyed() const {
@@ -39,8 +70,7 @@ void CObject::destroy_itself() {
 }
 
 void CObject::update_looks() {
-    if (m_DamageTicks.decrement())
-        m_IsHurt = false;
+    m_HurtObjects = nullptr;
 }
 
 int CObject::get_health() const {
@@ -60,5 +90,8 @@ std::shared_ptr<CObject> CObject::clone() const {
     return std::make_shared<CObject>(*this);
 }
 
-CObject::~CObject() = default;
+CObject::~CObject() {
+    if (m_HurtObjects != nullptr)
+        m_HurtObjects->remove(this, m_HurtExpiryTick);
+}
 
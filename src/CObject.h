@@ -2,8 +2,10 @@
 
 #include "CPosition.h"
 #include "CVisualBlock.h"
-#include "CTimeTicks.h"
+#include "CSpritePalette.h"
 #include "CUtilities.h"
+#include "CHurtObjectsRegistry.h"
+#include "CPoolAllocator.h"
 #include <utility>
 #include <map>
 #include <vector>
@@ -20,24 +22,44 @@ public:
     ///                           Actual health points are set to this number as well.
     /// @param[in] sprite Looks of the object.
     /// @param[in] canBeSteppedOn Whether entities can step on this object or not;
-    CObject(const CPosition& position, int maxHeathPoints, CVisualBlock sprite, bool canBeSteppedOn);
+    CObject(const CPosition& position, int maxHeathPoints, const CVisualBlock& sprite, bool canBeSteppedOn);
+    
+    /// Constructor of CObject.
+    /// @param[in] position Starting position of the object.
+    /// @param[in] maxHeathPoints Maximum health points of the object.
+    ///                           Actual health points are set to this number as well.
+    /// @param[in] sprite Looks of the object already interned in CSpritePalette.
+    /// @param[in] canBeSteppedOn Whether entities can step on this object or not;
+    CObject(const CPosition& position, int maxHeathPoints, CSpritePalette::SpriteId sprite, bool canBeSteppedOn);
     
     /// Virtual destructor since this class is used in polymorphic manner.
+    /// Unregisters the object from the registry of hurt objects.
     virtual ~CObject();
     
+    /// Copy constructor. The copy is not shown as hurt, since it is not registered in any CHurtObjectsRegistry.
+    CObject(const CObject& other);
+    
+    /// Copy operator=. The object stops being shown as hurt.
+    CObject& operator=(const CObject& other);
+    
     /// @return Current position of an object.
     [[nodiscard]] CPosition get_position() const;
     
     /// Deals damage to an object and reports, if the object has been destroyed.
+    /// The object gets registered in %hurtObjects, so it is shown as hurt for a while.
     /// @param[in] damagePoints How many health points should be taken.
+    /// @param[in, out] hurtObjects Registry of hurt objects of the game (see CWorldMap::get_hurt_objects()).
     /// @return Whether object was destroyed or not.
-    virtual bool deal_damage(int damagePoints);
+    virtual bool deal_damage(int damagePoints, CHurtObjectsRegistry& hurtObjects);
     
     /// @return Whether entities can step on this object or not;
     [[nodiscard]] virtual bool is_destroyed() const;
     
     /// @return Sprite of the object - it's looks.
-    [[nodiscard]] virtual CVisualBlock get_sprite() const;
+    [[nodiscard]] const CVisualBlock& get_sprite() const;
+    
+    /// @return ID of the sprite of the object in CSpritePalette (the hurt variant if the object is hurt).
+    [[nodiscard]] virtual CSpritePalette::SpriteId get_sprite_id() const;
     
     /// @return Whether object can be stepped on or not;
     [[nodiscard]] virtual bool can_be_stepped_on() const;
@@ -46,8 +68,8 @@ public:
     /// This causes the object to be destroyed (see bool is_destroyed()).
     void destroy_itself();
     
-    /// Updates object's visual state - meaning object's background color
-    /// will be set to red, if the object has been recently damaged.
+    /// Updates object's visual state - meaning object's background color will no longer be set to red.
+    /// Called by CHurtObjectsRegistry when the damage indication of the object runs out.
     virtual void update_looks();
     
     /// @return Health points of an object
@@ -61,11 +83,16 @@ public:
     [[nodiscard]] virtual std::shared_ptr<CObject> clone() const;
 
 protected:
+    
+    /// Registers the object in a registry of hurt objects, so it is shown as hurt for a while.
+    /// @param[in, out] hurtObjects Registry of hurt objects of the game.
+    void show_as_hurt(CHurtObjectsRegistry& hurtObjects);
+    
     /// Current position of an object.
     CPosition m_Position;
     
-    /// Looks of an object that can be rendered.
-    CVisualBlock m_Sprite;
+    /// Looks of an object that can be rendered (ID in CSpritePalette).
+    CSpritePalette::SpriteId m_Sprite;
     
     /// Maximum health points that object can have (also starting amount of health).
     int m_MaxHealthPoints;
@@ -76,10 +103,10 @@ protected:
     /// Whether object can be stepped on.
     bool m_CanBeSteppedOn;
     
-    /// Time class for showing damage
-    CTimeTicks m_DamageTicks;
+    /// Registry the object is registered in as hurt (nullptr if the object is not hurt).
+    /// This variable is automatically set when calling 'bool deal_damage()'.
+    CHurtObjectsRegistry* m_HurtObjects;
     
-    /// Bool indicating recent damage done to an object.
-    /// This variable is automatically set to true when calling 'bool deal_damage()'.
-    bool m_IsHurt;
+    /// Game tick at which the damage indication runs out (valid only if %m_HurtObjects is set).
+    uint64_t m_HurtExpiryTick;
 };
@@ -0,0 +1,57 @@
+#include "COutputBuffer.h"
+
+COutputBuffer::COutputBuffer()
+        : m_Bytes(INITIAL_CAPACITY) {
+    setp(m_Bytes.data(), m_Bytes.data() + m_Bytes.size());
+}
+
+bool COutputBuffer::write_to(int fileDescriptor) {
+    bool success = write_all(fileDescriptor, pbase(), size());
+    clear();
+    return success;
+}
+
+bool COutputBuffer::write_all(int fileDescriptor, const char* data, size_t size) {
+    // The terminal can accept only a part of the bytes, so write until everything is written.
+    while (size > 0) {
+        ssize_t written = write(fileDescriptor, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+const char* COutputBuffer::data() const {
+    return pbase();
+}
+
+size_t COutputBuffer::size() const {
+    return static_cast<size_t>(pptr() - pbase());
+}
+
+void COutputBuffer::clear() {
+    setp(m_Bytes.data(), m_Bytes.data() + m_Bytes.size());
+}
+
+COutputBuffer::int_type COutputBuffer::overflow(int_type character) {
+    // EOF only asks for a flush, there is nothing to put into the buffer.
+    if (traits_type::eq_int_type(character, traits_type::eof())) {
+        return traits_type::not_eof(character);
+    }
+    
+    // Grow the memory and move the put area into it.
+    size_t used = size();
+    m_Bytes.resize(m_Bytes.size() * 2);
+    setp(m_Bytes.data(), m_Bytes.data() + m_Bytes.size());
+    pbump(static_cast<int>(used));
+    
+    *pptr() = traits_type::to_char_type(character);
+    pbump(1);
+    return character;
+}
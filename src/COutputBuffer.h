@@ -0,0 +1,60 @@
+#pragma once
+
+#include <streambuf>
+#include <vector>
+#include <cstddef>
+#include <unistd.h>
+#include <cerrno>
+
+/// @brief Stream buffer that collects everything written into it in memory until 'write_to()' is called.
+///        The game encodes a whole frame (the world and the user interface) into one instance wrapped
+///        in std::ostream and then hands it to the terminal with a single 'write()' system call.
+///        The memory is kept between frames, so after the first few frames no allocations happen.
+class COutputBuffer : public std::streambuf {
+public:
+    
+    /// Number of bytes reserved in the constructor. Enough for most frames.
+    static constexpr size_t INITIAL_CAPACITY = 64 * 1024;
+    
+    /// Constructor of COutputBuffer.
+    COutputBuffer();
+    
+    /// The put area points into %m_Bytes, so the buffer cannot be copied.
+    COutputBuffer(const COutputBuffer& other) = delete;
+    
+    /// The put area points into %m_Bytes, so the buffer cannot be copied.
+    COutputBuffer& operator=(const COutputBuffer& other) = delete;
+    
+    /// Writes the collected bytes to a file descriptor and empties the buffer.
+    /// @param[in] fileDescriptor File descriptor to write to (usually STDOUT_FILENO).
+    /// @return False if writing failed. The unwritten bytes are dropped in that case.
+    bool write_to(int fileDescriptor);
+    
+    /// Writes bytes to a file descriptor, repeating the system call until everything is written.
+    /// @param[in] fileDescriptor File descriptor to write to.
+    /// @param[in] data Bytes to write.
+    /// @param[in] size Number of bytes to write.
+    /// @return False if writing failed.
+    static bool write_all(int fileDescriptor, const char* data, size_t size);
+    
+    /// @return Collected bytes (see 'size()').
+    [[nodiscard]] const char* data() const;
+    
+    /// @return Number of bytes collected since the last 'write_to()' or 'clear()'.
+    [[nodiscard]] size_t size() const;
+    
+    /// Drops the collected bytes.
+    void clear();
+
+protected:
+    
+    /// Called when the put area is full. Doubles the size of %m_Bytes.
+    /// @param[in] character Character that did not fit into the put area.
+    /// @return %character, or a value other than EOF if %character is EOF (a flush, which always succeeds).
+    int_type overflow(int_type character) override;
+
+private:
+    
+    /// Memory of the put area.
+    std::vector<char> m_Bytes;
+};
@@ -4,7 +4,7 @@ CPistol::CPistol(std::string name, const CBulletObjectBuilder& bulletBuilder, in
                  bool infiniteAmmo, bool doubleBullets)
         : CGun(std::move(name), bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, doubleBullets) {}
 
-void CPistol::shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
+void CPistol::shoot(CBulletStore& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
                     const CPosition& positionOfShooting, const CMapJoin& environment,
                     VOrientation::EVOrientation vOrientation,
                     HOrientation::EHOrientation hOrientation) {
@@ -20,6 +20,6 @@ void CPistol::shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr
 }
 
 std::shared_ptr<CGun> CPistol::clone() const {
-    return std::make_shared<CPistol>(*this);
+    return CPoolAllocator<CPistol>::make_shared(*this);
 }
 
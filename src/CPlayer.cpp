@@ -8,7 +8,7 @@ CPlayer::CPlayer(const std::shared_ptr<CMovableObject>& object,
         : CNonStaticEntity(object), m_Input(inputRecorder), m_CurrentGunId(0) {}
 
 bool CPlayer::update(const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
-                     std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap) {
+                     CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap) {
     
     // Update the guns internal state.
     if (number_of_guns() != 0) {
@@ -16,9 +16,11 @@ bool CPlayer::update(const std::shared_ptr<CMap>& mapContainingObject, const CMa
     }
     
     // Get actions from %m_Input and update the player based on them.
-    auto actions = m_Input->pop_actions();
     auto action = Action::NO_ACTION;
-    if (!actions.empty()) action = actions[0]; // Only register first input otherwise player could do more actions in one tick.
+    std::chrono::steady_clock::time_point keyTime;
+    if (m_Input->pop_action(action, keyTime))
+        m_ActionLatency.record(std::chrono::steady_clock::now() - keyTime);
+    m_Input->discard_actions(); // Only register first input otherwise player could do more actions in one tick.
     
     // Try shooting or selecting different gun.
     if (action == Action::ATTACK && number_of_guns() != 0) {
@@ -47,6 +49,10 @@ void CPlayer::add_gun(const CGun& newGun) {
     m_Guns.emplace_back(newGun.clone());
 }
 
+const CLatencyStatistics& CPlayer::get_action_latency() const {
+    return m_ActionLatency;
+}
+
 void CPlayer::select_gun(int gunId) {
     CUtilities::cap_value(m_CurrentGunId = gunId, 0, number_of_guns() - 1);
 }
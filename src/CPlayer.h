@@ -3,9 +3,10 @@
 #include "CNonStaticEntity.h"
 #include "CActionsInputRecorder.h"
 #include "CDamagingMovableObject.h"
-#include "CBullet.h"
+#include "CBulletStore.h"
 #include "CUtilities.h"
 #include "CGun.h"
+#include "CLatencyStatistics.h"
 #include <memory>
 #include <map>
 #include <vector>
@@ -34,12 +35,12 @@ public:
     ///                                     Necessary for keeping mapping between object and position up to date.
     ///                                     This method also deletes object from this CMap, if it is destroyed.
     /// @param[in, out] environment CMap of objects that can interact with enemy's object.
-    /// @param[out] bullets List of bullets so that the player can shoot.
+    /// @param[out] bullets Container of bullets so that the player can shoot.
     /// @param[out] bulletMap Map containing bullet objects so that player can shoot.
     /// @return Whether player has died or not.
     /// @warning This method should not be called until player has not been initialised with object and actions input recorder.
     bool update(const std::shared_ptr<CMap>& mapContainingObject, const CMapJoin& environment,
-                std::list<CBullet>& bullets, const std::shared_ptr<CMap>& bulletMap);
+                CBulletStore& bullets, const std::shared_ptr<CMap>& bulletMap);
     
     /// @return Pointer to player's current selected gun.
     [[nodiscard]] std::shared_ptr<CGun> current_gun() const;
@@ -47,6 +48,9 @@ public:
     /// Adds gun to the vector of guns the player can shoot with.
     /// @param newGun Gun that should be added.
     void add_gun(const CGun& newGun);
+    
+    /// @return Times between reading the keys of the actions and acting on them by 'update()'.
+    [[nodiscard]] const CLatencyStatistics& get_action_latency() const;
 
 private:
     /// @return The number of guns that the player currently has.
@@ -65,4 +69,7 @@ private:
     
     /// Vector of guns that the player can shoot with.
     std::vector<std::shared_ptr<CGun>> m_Guns;
+    
+    /// Times between reading the keys of the actions and acting on them.
+    CLatencyStatistics m_ActionLatency;
 };
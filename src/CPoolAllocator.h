@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CMemoryPool.h"
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <cxxabi.h>
+#include <cstdlib>
+#include <cstddef>
+
+/// @brief Standard library allocator taking single objects from a recycling CMemoryPool.
+///        Every allocated type gets its own pool, which is shared by all allocators of that type.
+///        Used with 'std::allocate_shared()' (see 'make_shared()'), the object and its reference count
+///        are put into one pooled block.
+/// @tparam T Type of the allocated objects.
+/// @tparam Owner Type the pool is named after in reports. It is kept when the allocator is rebound
+///               (for example to the control block of std::shared_ptr), so reports show the original type.
+template<typename T, typename Owner = T>
+class CPoolAllocator {
+public:
+    
+    /// Type of the allocated objects.
+    typedef T value_type;
+    
+    /// Allocator of a different type sharing the same %Owner.
+    template<typename U>
+    struct rebind {
+        typedef CPoolAllocator<U, Owner> other;
+    };
+    
+    /// Default constructor of CPoolAllocator.
+    CPoolAllocator() = default;
+    
+    /// Converting constructor used when the allocator is rebound.
+    template<typename U>
+    CPoolAllocator(const CPoolAllocator<U, Owner>& other);
+    
+    /// Allocates memory for %n objects. Single objects are taken from the pool.
+    /// @param[in] n Number of objects.
+    /// @return Pointer to the allocated memory.
+    T* allocate(size_t n);
+    
+    /// Returns memory previously allocated by 'allocate()'.
+    /// @param[in] pointer Pointer to the memory.
+    /// @param[in] n Number of objects the memory was allocated for.
+    void deallocate(T* pointer, size_t n);
+    
+    /// Creates an object in a pooled block (see 'std::allocate_shared()').
+    /// @param[in] args Arguments passed to the constructor of the object.
+    /// @return Pointer to the new object.
+    template<typename... Args>
+    static std::shared_ptr<T> make_shared(Args&& ... args);
+    
+    /// @return All allocators of the same types share one pool, so they are always equal.
+    template<typename U>
+    bool operator==(const CPoolAllocator<U, Owner>& other) const;
+    
+    /// @return All allocators of the same types share one pool, so they are always equal.
+    template<typename U>
+    bool operator!=(const CPoolAllocator<U, Owner>& other) const;
+
+private:
+    
+    /// @return Pool that holds objects of type %T.
+    static CMemoryPool& pool();
+};
+
+template<typename T, typename Owner>
+template<typename U>
+CPoolAllocator<T, Owner>::CPoolAllocator(const CPoolAllocator<U, Owner>&) {}
+
+template<typename T, typename Owner>
+template<typename U>
+bool CPoolAllocator<T, Owner>::operator==(const CPoolAllocator<U, Owner>&) const {
+    return true;
+}
+
+template<typename T, typename Owner>
+template<typename U>
+bool CPoolAllocator<T, Owner>::operator!=(const CPoolAllocator<U, Owner>&) const {
+    return false;
+}
+
+template<typename T, typename Owner>
+T* CPoolAllocator<T, Owner>::allocate(size_t n) {
+    if (n != 1)
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    return static_cast<T*>(pool().allocate());
+}
+
+template<typename T, typename Owner>
+void CPoolAllocator<T, Owner>::deallocate(T* pointer, size_t n) {
+    if (n != 1) {
+        ::operator delete(pointer, std::align_val_t(alignof(T)));
+        return;
+    }
+    pool().deallocate(pointer);
+}
+
+template<typename T, typename Owner>
+template<typename... Args>
+std::shared_ptr<T> CPoolAllocator<T, Owner>::make_shared(Args&& ... args) {
+    return std::allocate_shared<T>(CPoolAllocator<T, Owner>(), std::forward<Args>(args)...);
+}
+
+template<typename T, typename Owner>
+CMemoryPool& CPoolAllocator<T, Owner>::pool() {
+    // The pool is never destroyed, so objects freed during static destruction can still be returned to it.
+    static CMemoryPool* pool = [] {
+        int status;
+        char* demangled = abi::__cxa_demangle(typeid(Owner).name(), nullptr, nullptr, &status);
+        std::string name = status == 0 ? demangled : typeid(Owner).name();
+        std::free(demangled);
+        return new CMemoryPool(name, sizeof(T), alignof(T));
+    }();
+    return *pool;
+}
@@ -0,0 +1,10 @@
+#include "CRandomBot.h"
+
+void CRandomBot::act(const CPlayer& player, const CMap& entities,
+                     const CMapJoin& environment, CActionsInputRecorder& controls) {
+    static_cast<void>(player);
+    static_cast<void>(entities);
+    static_cast<void>(environment);
+    controls.record_action(static_cast<Action::EAction>(rand() % Action::ACTION_COUNT),
+                           std::chrono::steady_clock::now());
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CBot.h"
+#include "EAction.h"
+#include <cstdlib>
+
+/// @brief Bot that picks a random action every tick (like a player mashing the keys).
+///        It uses rand() as the rest of the game, so a simulation with the same seed is repeated exactly.
+class CRandomBot : public CBot {
+public:
+    
+    /// Records a random action (including no action).
+    /// @param[in] player Player controlled by the bot.
+    /// @param[in] entities Map of the player and the enemies.
+    /// @param[in] environment Map of objects that block the player (walls).
+    /// @param[in, out] controls Controls of the player.
+    void act(const CPlayer& player, const CMap& entities,
+             const CMapJoin& environment, CActionsInputRecorder& controls) override;
+};
@@ -6,7 +6,7 @@ CRangedEnemy::CRangedEnemy(const std::shared_ptr<CMovableObject>& object, const
 
 bool
 CRangedEnemy::inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                           const CMapJoin& environment, std::list<CBullet>& bullets,
+                           const CMapJoin& environment, CBulletStore& bullets,
                            const std::shared_ptr<CMap>& bulletMap) {
     
     // Update the internal state of the gun.
@@ -37,10 +37,10 @@ protected:
     ///                                     Necessary for keeping mapping between object and position up to date.
     ///                                     This method also deletes object from this CMap, if it is destroyed.
     /// @param[in, out] environment CMap of objects that can interact with enemy's object.
-    /// @param[out] bullets List of bullets so this enemy can add bullets into the game.
+    /// @param[out] bullets Container of bullets so this enemy can add bullets into the game.
     /// @param[out] bulletMap Map containing bullet objects so this enemy can add bullets into the game.
     bool inner_update(Action::EAction action, CObject& player, const std::shared_ptr<CMap>& mapContainingObject,
-                      const CMapJoin& environment, std::list<CBullet>& bullets,
+                      const CMapJoin& environment, CBulletStore& bullets,
                       const std::shared_ptr<CMap>& bulletMap) override;
     
     /// Pointer to the gun this enemy uses to shoot.
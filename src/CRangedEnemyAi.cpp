@@ -1,28 +1,20 @@
 #include "CRangedEnemyAi.h"
 
 std::shared_ptr<CEnemyAi> CRangedEnemyAi::clone() const {
-    return std::make_shared<CRangedEnemyAi>(*this);
+    return CPoolAllocator<CRangedEnemyAi>::make_shared(*this);
 }
 
 Action::EAction CRangedEnemyAi::decide_action(const CPosition& startPosition, const CPosition& targetPosition,
                                               const CMapJoin& toAvoid, Direction::EDirection facingDirection) {
     
-    using namespace Direction;
-    CPosition positions[] = {startPosition, startPosition, startPosition, startPosition};
-    EDirection directions[] = {UP, DOWN, LEFT, RIGHT};
-    
-    for (int d = 1; d <= m_DistanceToLookInto; ++d) {
-        for (int i = 0; i < 4; ++i) {
-            
-            positions[i] += directions[i];
-            if (positions[i] == targetPosition) {
-                if (directions[i] == facingDirection) {
-                    return Action::ATTACK;
-                }
-                return CUtilities::action_from_direction(directions[i]);
-            }
-            
+    // Ask the visibility index of the world whether the player can be seen along the row or the column.
+    Direction::EDirection sightDirection = toAvoid.direction_of_sight(startPosition, targetPosition,
+                                                                      m_DistanceToLookInto);
+    if (sightDirection != Direction::NONE) {
+        if (sightDirection == facingDirection) {
+            return Action::ATTACK;
         }
+        return CUtilities::action_from_direction(sightDirection);
     }
     
     return m_NavigationAi->decide_action(startPosition, targetPosition, toAvoid, facingDirection);
@@ -3,7 +3,7 @@
 #include "CFollowerAi.h"
 #include <algorithm>
 
-/// @brief Class extending CEnemyAi by implementing decision to shoot when player is in direct line of the enemy.
+/// @brief Class extending CEnemyAi by implementing decision to shoot when player is in direct line of sight of the enemy.
 class CRangedEnemyAi : public CEnemyAi {
 public:
     
@@ -14,11 +14,11 @@ public:
     CRangedEnemyAi(int distanceToLookInto, const CFollowerAi& navigationAi);
     
     /// Method deciding which action to take based on given arguments.
-    /// If the player (targetPosition) is in direct line with the enemy (startPosition), it will return Action::ATTACK.
-    /// If not, it will let the CFollowerAi decide how to move.
+    /// If the player (targetPosition) is in direct line with the enemy (startPosition) and there is no wall
+    /// between them, it will return Action::ATTACK. If not, it will let the CFollowerAi decide how to move.
     /// @param[in] startPosition The position that the enemy currently is.
     /// @param[in] targetPosition Position that is supposed to be reached (presumably player's position).
-    /// @param[in] toAvoid Map of objects that should be avoided if possible (with movement, this AI also tries to shoot through walls).
+    /// @param[in] toAvoid Map of objects that should be avoided if possible (the walls of its world also block the sight).
     /// @param[in] facingDirection Direction that the enemy is currently facing.
     Action::EAction decide_action(const CPosition& startPosition, const CPosition& targetPosition,
                                   const CMapJoin& toAvoid, Direction::EDirection facingDirection) override;
@@ -0,0 +1,175 @@
+#include "CRenderPipeline.h"
+
+CRenderPipeline::CSnapshot::CSnapshot(const CFrameBuffer& frame)
+        : m_Frame(frame), m_FrameNumber(0), m_RowChangedAt(frame.get_height(), 0), m_Health(0), m_Ammo(0),
+          m_ResetCount(0) {}
+
+void CRenderPipeline::CStatistics::print(std::ostream& os) const {
+    os << "Render pipeline (stage latencies):" << std::endl;
+    m_Simulation.print("Simulation", os);
+    m_Waiting.print("Waiting for render", os);
+    m_Render.print("Render", os);
+    m_Output.print("Output", os);
+    os << " Frames: " << m_FramesPublished << " published, " << m_FramesRendered << " rendered" << std::endl;
+}
+
+CRenderPipeline::CRenderPipeline(const CSnapshot& initial, CSpritePalette::SpriteId background,
+                                 InterfaceRenderer interfaceRenderer, CTerminalBackend& backend)
+        : m_Snapshots(initial),
+          m_FrameEncoder(initial.m_Frame.get_width(), initial.m_Frame.get_height(), background),
+          m_InterfaceRenderer(std::move(interfaceRenderer)), m_Backend(backend),
+          m_FrameStream(&m_FrameBytes), m_RenderedResetCount(initial.m_ResetCount),
+          m_RenderedFrameNumber(initial.m_FrameNumber),
+          m_Output(OUTPUT_CAPACITY), m_SkipSnapshots(backend.is_interactive()), m_Stopping(false), m_RenderFinished(false),
+          m_OutputFailed(false), m_Stopped(false) {
+    
+    // Start the threads once everything they use is initialized.
+    m_RenderThread = std::thread(&CRenderPipeline::render_loop, this);
+    m_OutputThread = std::thread(&CRenderPipeline::output_loop, this);
+}
+
+CRenderPipeline::~CRenderPipeline() {
+    stop();
+}
+
+CRenderPipeline::CSnapshot& CRenderPipeline::snapshot_to_publish() {
+    return m_Snapshots.back();
+}
+
+void CRenderPipeline::publish(std::chrono::steady_clock::duration simulationTime) {
+    m_Snapshots.back().m_PublishTime = std::chrono::steady_clock::now();
+    m_Statistics.m_Simulation.record(simulationTime);
+    m_Statistics.m_FramesPublished++;
+    
+    // Every snapshot has to be rendered, so the previous one has to be taken first.
+    while (!m_SkipSnapshots && m_Snapshots.is_published_pending())
+        m_SnapshotTaken.wait();
+    
+    m_Snapshots.publish();
+    m_SnapshotPublished.notify();
+}
+
+void CRenderPipeline::stop() {
+    if (m_Stopped)
+        return;
+    m_Stopped = true;
+    
+    m_Stopping.store(true, std::memory_order_release);
+    m_SnapshotPublished.notify();
+    m_RenderThread.join();
+    m_OutputThread.join();
+}
+
+const CRenderPipeline::CStatistics& CRenderPipeline::get_statistics() const {
+    return m_Statistics;
+}
+
+bool CRenderPipeline::has_failed() const {
+    return m_OutputFailed.load(std::memory_order_acquire);
+}
+
+void CRenderPipeline::render_loop() {
+    while (true) {
+        m_SnapshotPublished.wait();
+        
+        // Check for stopping first, so the last snapshot published before stopping is rendered.
+        bool stopping = m_Stopping.load(std::memory_order_acquire);
+        if (m_Snapshots.update()) {
+            m_SnapshotTaken.notify();
+            // Encoding frames for a terminal that is gone would be wasted.
+            if (!has_failed())
+                render_snapshot(m_Snapshots.front());
+        }
+        if (stopping)
+            break;
+    }
+    
+    m_RenderFinished.store(true, std::memory_order_release);
+    m_OutputAvailable.notify();
+}
+
+void CRenderPipeline::render_snapshot(const CSnapshot& snapshot) {
+    auto startTime = std::chrono::steady_clock::now();
+    m_Statistics.m_Waiting.record(startTime - snapshot.m_PublishTime);
+    
+    // The screen should be rendered as a whole.
+    bool afterReset = snapshot.m_ResetCount != m_RenderedResetCount;
+    if (afterReset) {
+        m_RenderedResetCount = snapshot.m_ResetCount;
+        m_FrameStream << CTerminal::reset_graphics() << CTerminal::erase_entire_screen();
+        m_FrameEncoder.reset();
+    }
+    
+    size_t cellsBefore = m_FrameEncoder.get_cells_written();
+    m_FrameEncoder.begin_frame(m_FrameStream);
+    if (afterReset) {
+        m_FrameEncoder.render_changes(snapshot.m_Frame, m_FrameStream);
+    } else {
+        render_damage(snapshot);
+    }
+    m_RenderedFrameNumber = snapshot.m_FrameNumber;
+    m_InterfaceRenderer(snapshot, afterReset, m_FrameStream);
+    
+    m_Statistics.m_Render.record(std::chrono::steady_clock::now() - startTime);
+    m_Statistics.m_FramesRendered++;
+    m_Backend.record_frame(m_FrameEncoder.get_cells_written() - cellsBefore, m_FrameBytes.size());
+    send_frame();
+}
+
+void CRenderPipeline::render_damage(const CSnapshot& snapshot) {
+    // The screen shows the previous frame, so only the damaged ranges of this frame can differ.
+    if (snapshot.m_FrameNumber == m_RenderedFrameNumber + 1) {
+        for (const auto& row: snapshot.m_DamagedRows) {
+            m_FrameEncoder.render_changes_in_row(snapshot.m_Frame, row.m_Y, row.m_From, row.m_To, m_FrameStream);
+        }
+        return;
+    }
+    
+    // Some frames have been skipped, their damaged ranges are not known, but their rows are.
+    int width = snapshot.m_Frame.get_width();
+    for (int y = 0; y < snapshot.m_Frame.get_height(); ++y) {
+        if (snapshot.m_RowChangedAt[y] > m_RenderedFrameNumber) {
+            m_FrameEncoder.render_changes_in_row(snapshot.m_Frame, y, 0, width - 1, m_FrameStream);
+        }
+    }
+}
+
+void CRenderPipeline::send_frame() {
+    const char* data = m_FrameBytes.data();
+    size_t remaining = m_FrameBytes.size();
+    while (remaining > 0) {
+        size_t written = m_Output.write(data, remaining);
+        data += written;
+        remaining -= written;
+        if (written > 0)
+            m_OutputAvailable.notify();
+        
+        // The terminal is slower than rendering, wait until the output thread makes some space.
+        if (remaining > 0)
+            m_OutputSpaceAvailable.wait();
+    }
+    m_FrameBytes.clear();
+}
+
+void CRenderPipeline::output_loop() {
+    std::vector<char> chunk(OUTPUT_CHUNK_SIZE);
+    while (true) {
+        size_t count = m_Output.read(chunk.data(), chunk.size());
+        if (count == 0) {
+            // Everything the render thread has sent has been written.
+            if (m_RenderFinished.load(std::memory_order_acquire) && m_Output.empty())
+                break;
+            m_OutputAvailable.wait();
+            continue;
+        }
+        m_OutputSpaceAvailable.notify();
+        
+        // After a failure the bytes are only drained, so the render thread never waits for space.
+        if (has_failed())
+            continue;
+        auto startTime = std::chrono::steady_clock::now();
+        if (!m_Backend.write(chunk.data(), count))
+            m_OutputFailed.store(true, std::memory_order_release);
+        m_Statistics.m_Output.record(std::chrono::steady_clock::now() - startTime);
+    }
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "CFrameBuffer.h"
+#include "CFrameEncoder.h"
+#include "COutputBuffer.h"
+#include "CTripleBuffer.h"
+#include "CSpscRing.h"
+#include "CWakeupSignal.h"
+#include "CLatencyStatistics.h"
+#include "CTerminal.h"
+#include "CTerminalBackend.h"
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <string>
+#include <ostream>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/// @brief Pipeline that renders the game on two threads of its own, so the simulation never waits for the terminal.
+///        The simulation thread fills a snapshot of the game (the composed frame and the values shown
+///        by the user interface) and publishes it through a lock-free triple buffer (see CTripleBuffer).
+///        The render thread takes the newest snapshot, encodes its differences against the screen
+///        (see CFrameEncoder) and puts the bytes into a lock-free ring buffer (see CSpscRing). Only the rows
+///        the snapshot marks as damaged are compared, the whole frame is compared only after a reset.
+///        The output thread drains the ring buffer into the terminal (see CTerminalBackend).
+///        If the terminal is slow, the ring buffer fills up and the render thread waits for it, while
+///        the simulation keeps publishing - the snapshots the render thread did not get to are skipped.
+///        Without a player (see CTerminalBackend::is_interactive()) nothing is skipped, the simulation
+///        waits for the render thread instead, so the cost of rendering every tick gets measured.
+///        Durations of all stages are collected (see CStatistics).
+class CRenderPipeline {
+public:
+    
+    /// State of the game needed to render one frame.
+    struct CSnapshot {
+        
+        /// Range of cells of a row that could have changed since the previous frame.
+        struct CDamagedRow {
+            
+            /// Y coordinate of the row.
+            int m_Y;
+            
+            /// X coordinate of the first cell that could have changed.
+            int m_From;
+            
+            /// X coordinate of the last cell that could have changed.
+            int m_To;
+        };
+        
+        /// Constructor of CSnapshot.
+        /// @param[in] frame Frame with the size of the level.
+        explicit CSnapshot(const CFrameBuffer& frame);
+        
+        /// Composed frame (see CRenderer::export_frame()).
+        CFrameBuffer m_Frame;
+        
+        /// Number of the frame, frames are numbered from 1 (0 means no frame has been exported into the snapshot).
+        uint64_t m_FrameNumber;
+        
+        /// Ranges of the rows that could have changed since the frame with number %m_FrameNumber - 1, from the top.
+        std::vector<CDamagedRow> m_DamagedRows;
+        
+        /// Number of the last frame in which each row could have changed. Used when the frames between
+        /// the last rendered frame and this one have been skipped.
+        std::vector<uint64_t> m_RowChangedAt;
+        
+        /// Player's health.
+        int m_Health;
+        
+        /// Number of bullets in player's magazine.
+        int m_Ammo;
+        
+        /// Name of the gun that player has currently selected.
+        std::string m_GunName;
+        
+        /// Number of requests to render the whole screen again. When it changes, the render thread
+        /// clears the screen and renders everything (not just the differences).
+        uint64_t m_ResetCount;
+        
+        /// When the snapshot was published.
+        std::chrono::steady_clock::time_point m_PublishTime;
+    };
+    
+    /// Durations of the stages of the pipeline and the number of frames that went through it.
+    struct CStatistics {
+        
+        /// Prints the statistics.
+        /// @param[in, out] os Stream to print into.
+        void print(std::ostream& os) const;
+        
+        /// Durations of game ticks including composing and publishing of the frame (simulation thread).
+        CLatencyStatistics m_Simulation;
+        
+        /// Time between publishing a snapshot and the start of its rendering.
+        CLatencyStatistics m_Waiting;
+        
+        /// Durations of encoding of the frames (render thread).
+        CLatencyStatistics m_Render;
+        
+        /// Durations of writes into the terminal (output thread).
+        CLatencyStatistics m_Output;
+        
+        /// Number of published snapshots.
+        size_t m_FramesPublished = 0;
+        
+        /// Number of rendered snapshots, the rest has been skipped.
+        size_t m_FramesRendered = 0;
+    };
+    
+    /// Function rendering the user interface of a snapshot on the render thread.
+    /// It gets the snapshot, whether the screen has just been cleared and the stream to render into.
+    typedef std::function<void(const CSnapshot&, bool, std::ostream&)> InterfaceRenderer;
+    
+    /// Number of bytes the ring buffer between the render thread and the output thread can hold.
+    static constexpr size_t OUTPUT_CAPACITY = 1024 * 1024;
+    
+    /// Maximum number of bytes the output thread writes into the terminal at once.
+    static constexpr size_t OUTPUT_CHUNK_SIZE = 64 * 1024;
+    
+    /// Constructor of CRenderPipeline. Starts the render and the output thread.
+    /// Everything written into the terminal by other means has to be flushed before.
+    /// @param[in] initial Snapshot all slots of the triple buffer are initialized to (it is not rendered).
+    /// @param[in] background Sprite shown where there is no object.
+    /// @param[in] interfaceRenderer Function rendering the user interface (called on the render thread).
+    /// @param[in, out] backend Terminal the frames are written into, the cost of each frame is reported to it.
+    ///                         It has to outlive the pipeline.
+    CRenderPipeline(const CSnapshot& initial, CSpritePalette::SpriteId background,
+                    InterfaceRenderer interfaceRenderer, CTerminalBackend& backend);
+    
+    /// Destructor of CRenderPipeline. Stops the pipeline if it is still running (see 'stop()').
+    ~CRenderPipeline();
+    
+    /// The threads refer to the instance, so it cannot be copied.
+    CRenderPipeline(const CRenderPipeline& other) = delete;
+    
+    /// The threads refer to the instance, so it cannot be copied.
+    CRenderPipeline& operator=(const CRenderPipeline& other) = delete;
+    
+    /// @return Snapshot that should be filled and then published by 'publish()'. It holds an older snapshot.
+    /// @warning Can only be called from the simulation thread.
+    CSnapshot& snapshot_to_publish();
+    
+    /// Publishes the snapshot returned by 'snapshot_to_publish()'. Never waits for the other threads,
+    /// unless the backend is not interactive - then it waits until the previous snapshot is taken.
+    /// @param[in] simulationTime How long simulating the tick of the snapshot took.
+    /// @warning Can only be called from the simulation thread.
+    void publish(std::chrono::steady_clock::duration simulationTime);
+    
+    /// Renders the last published snapshot, writes everything into the terminal and stops the threads.
+    void stop();
+    
+    /// @return Statistics of the stages. Complete only after 'stop()'.
+    [[nodiscard]] const CStatistics& get_statistics() const;
+    
+    /// @return Whether writing into the terminal has failed (see CTerminalBackend::write()).
+    ///         Nothing gets rendered from then on, so the game should end.
+    [[nodiscard]] bool has_failed() const;
+
+private:
+    
+    /// Main function of the render thread.
+    void render_loop();
+    
+    /// Main function of the output thread.
+    void output_loop();
+    
+    /// Encodes a snapshot into %m_FrameStream and passes the bytes to the output thread.
+    /// @param[in] snapshot Snapshot to render.
+    void render_snapshot(const CSnapshot& snapshot);
+    
+    /// Encodes the cells of a snapshot that could have changed since the last rendered snapshot.
+    /// @param[in] snapshot Snapshot to render.
+    void render_damage(const CSnapshot& snapshot);
+    
+    /// Moves the bytes of %m_FrameBytes into %m_Output, waits for the output thread if there is not enough space.
+    void send_frame();
+    
+    /// Snapshots passed from the simulation thread to the render thread.
+    CTripleBuffer<CSnapshot> m_Snapshots;
+    
+    /// Encoder of the frames, used only by the render thread.
+    CFrameEncoder m_FrameEncoder;
+    
+    /// Function rendering the user interface.
+    InterfaceRenderer m_InterfaceRenderer;
+    
+    /// Terminal the frames are written into.
+    CTerminalBackend& m_Backend;
+    
+    /// Memory a frame is encoded into by the render thread.
+    COutputBuffer m_FrameBytes;
+    
+    /// Stream writing into %m_FrameBytes.
+    std::ostream m_FrameStream;
+    
+    /// Reset count (see CSnapshot::m_ResetCount) of the last rendered snapshot.
+    uint64_t m_RenderedResetCount;
+    
+    /// Frame number (see CSnapshot::m_FrameNumber) of the last rendered snapshot.
+    uint64_t m_RenderedFrameNumber;
+    
+    /// Encoded bytes passed from the render thread to the output thread.
+    CSpscRing<char> m_Output;
+    
+    /// Wakes up the render thread when a snapshot is published or the pipeline stops.
+    CWakeupSignal m_SnapshotPublished;
+    
+    /// Wakes up the simulation thread when the render thread takes a snapshot (used if %m_SkipSnapshots is false).
+    CWakeupSignal m_SnapshotTaken;
+    
+    /// Whether snapshots the render thread did not get to may be skipped.
+    bool m_SkipSnapshots;
+    
+    /// Wakes up the output thread when there are bytes to write or the render thread finishes.
+    CWakeupSignal m_OutputAvailable;
+    
+    /// Wakes up the render thread when the output thread makes space in %m_Output.
+    CWakeupSignal m_OutputSpaceAvailable;
+    
+    /// Set when the pipeline should stop.
+    std::atomic<bool> m_Stopping;
+    
+    /// Set when the render thread has rendered everything.
+    std::atomic<bool> m_RenderFinished;
+    
+    /// Set by the output thread when writing into the terminal fails.
+    std::atomic<bool> m_OutputFailed;
+    
+    /// Whether the threads have been joined.
+    bool m_Stopped;
+    
+    /// Statistics of the stages, each stage writes only its own members.
+    CStatistics m_Statistics;
+    
+    /// Thread encoding the snapshots.
+    std::thread m_RenderThread;
+    
+    /// Thread writing into the terminal.
+    std::thread m_OutputThread;
+};
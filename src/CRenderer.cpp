@@ -1,101 +1,134 @@
 #include "CRenderer.h"
 
 CRenderer::CRenderer(int screenWidth, int screenHeight, const CConfig& config)
-        : m_CurrentBufferId(0), m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight),
+        : m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight),
           m_DefaultVisualBlock("  ", Color::BLACK, config.m_Color["BACKGROUND_COLOR"]),
-          m_InitialRender(true) {}
+          m_DefaultSprite(CSpritePalette::intern(m_DefaultVisualBlock)),
+          m_StaticLayer(screenWidth, screenHeight, m_DefaultSprite),
+          m_DynamicLayer(screenWidth, screenHeight, CSpritePalette::NO_SPRITE),
+          m_Frame(screenWidth, screenHeight, m_DefaultSprite),
+          m_DamagedFrom(std::max(screenHeight, 0), INT_MAX),
+          m_DamagedTo(std::max(screenHeight, 0), -1),
+          m_AllDamaged(false), m_FrameNumber(0), m_RowChangedAt(std::max(screenHeight, 0), 0) {}
 
 void CRenderer::put_sprite_at(const CVisualBlock& sprite, const CPosition& position) {
+    put_sprite_at(CSpritePalette::intern(sprite), position);
+}
+
+void CRenderer::put_sprite_at(CSpritePalette::SpriteId sprite, const CPosition& position) {
+    set_layer_cell(m_DynamicLayer, sprite, position);
+}
+
+void CRenderer::clear_cell(const CPosition& position) {
+    set_layer_cell(m_DynamicLayer, CSpritePalette::NO_SPRITE, position);
+}
+
+void CRenderer::prepare_static_to_render(const CObject& objectToRender) {
+    set_layer_cell(m_StaticLayer, objectToRender.get_sprite_id(), objectToRender.get_position());
+}
+
+void CRenderer::clear_static_cell(const CPosition& position) {
+    set_layer_cell(m_StaticLayer, m_DefaultSprite, position);
+}
+
+void CRenderer::set_layer_cell(Buffer& layer, CSpritePalette::SpriteId sprite, const CPosition& position) {
     /// Check if the sprite position is in the set range.
-    if (CUtilities::is_in_range(position.m_X, 0, m_ScreenWidth - 1)
-        && CUtilities::is_in_range(position.m_Y, 0, m_ScreenHeight - 1)) {
-        current_buffer()[position] = sprite;
+    if (!CUtilities::is_in_range(position.m_X, 0, m_ScreenWidth - 1)
+        || !CUtilities::is_in_range(position.m_Y, 0, m_ScreenHeight - 1)) {
+        return;
     }
+    layer.set(position.m_X, position.m_Y, sprite);
+    
+    // Objects in the dynamic layer are drawn over the static layer.
+    CSpritePalette::SpriteId dynamic = m_DynamicLayer.get(position.m_X, position.m_Y);
+    m_Frame.set(position.m_X, position.m_Y,
+                dynamic != CSpritePalette::NO_SPRITE ? dynamic : m_StaticLayer.get(position.m_X, position.m_Y));
+    damage(position.m_X, position.m_Y);
 }
 
-CRenderer::Buffer& CRenderer::current_buffer() {
-    return m_Buffers[m_CurrentBufferId];
+void CRenderer::damage(int x, int y) {
+    if (m_AllDamaged)
+        return;
+    if (m_DamagedFrom[y] == INT_MAX)
+        m_DamagedRows.push_back(y);
+    m_DamagedFrom[y] = std::min(m_DamagedFrom[y], x);
+    m_DamagedTo[y] = std::max(m_DamagedTo[y], x);
 }
 
-CRenderer::Buffer& CRenderer::previous_buffer() {
-    return m_Buffers[!m_CurrentBufferId];
+void CRenderer::damage_all() {
+    m_AllDamaged = true;
 }
 
-void CRenderer::render_differences(std::ostream& os) {
-    if (m_InitialRender) {
-        m_InitialRender = false;
-        do_initial_render(os);
+void CRenderer::export_frame(CRenderPipeline::CSnapshot& snapshot) {
+    ++m_FrameNumber;
+    
+    // Rows are published from the top, so the cursor mostly moves forward.
+    snapshot.m_DamagedRows.clear();
+    if (m_AllDamaged) {
+        std::fill(m_RowChangedAt.begin(), m_RowChangedAt.end(), m_FrameNumber);
+        for (int y = 0; y < m_ScreenHeight; ++y) {
+            snapshot.m_DamagedRows.push_back({y, 0, m_ScreenWidth - 1});
+        }
+    } else {
+        std::sort(m_DamagedRows.begin(), m_DamagedRows.end());
+        for (int y: m_DamagedRows) {
+            m_RowChangedAt[y] = m_FrameNumber;
+            snapshot.m_DamagedRows.push_back({y, m_DamagedFrom[y], m_DamagedTo[y]});
+        }
     }
     
-    // Loop through all possible coordinates and render differences.
+    // The snapshot holds an older frame, the rows that changed since then have to be copied.
     for (int y = 0; y < m_ScreenHeight; ++y) {
-        for (int x = 0; x < m_ScreenWidth; ++x) {
-            CPosition currentPos(x, y);
-            
-            auto blockIt = current_buffer().find(currentPos);
-            bool blockExists = blockIt != current_buffer().end();
-            //
-            auto prevBlockIt = previous_buffer().find(currentPos);
-            bool blockExisted = prevBlockIt != previous_buffer().end();
-            
-            if (blockExists && !blockExisted) {
-                // Sprite now exits but did not exist during the previous frame
-                // -> render it.
-                render_sprite_at(blockIt->second, currentPos, os);
-                
-            } else if (!blockExists && blockExisted) {
-                // Visual block no longer exists
-                // -> render the default one.
-                render_sprite_at(m_DefaultVisualBlock, currentPos, os);
-                
-            } else if (blockExists && blockExisted
-                       && (blockIt->second != prevBlockIt->second)) {
-                // Some sprite exists in the current and previous buffer
-                // and they differ.
-                // -> render the current one.
-                render_sprite_at(blockIt->second, currentPos, os);
-                
-            }
+        if (m_RowChangedAt[y] > snapshot.m_FrameNumber) {
+            snapshot.m_Frame.copy_row(m_Frame, y);
         }
     }
+    snapshot.m_RowChangedAt = m_RowChangedAt;
+    snapshot.m_FrameNumber = m_FrameNumber;
+    
+    record_frame();
+    clear_damage();
 }
 
-void CRenderer::render_sprite(const CVisualBlock& sprite, std::ostream& os) {
-    os << CTerminal::set_color(sprite.m_ForegroundColor);
-    os << CTerminal::set_background_color(sprite.m_BackgroundColor);
-    os << sprite.m_Content << std::flush;
+CSpritePalette::SpriteId CRenderer::get_background() const {
+    return m_DefaultSprite;
 }
 
-void CRenderer::render_sprite_at(const CVisualBlock& sprite, const CPosition& position, std::ostream& os) {
-    os << CTerminal::move_cursor_to(position);
-    render_sprite(sprite, os);
+void CRenderer::clear_damage() {
+    for (int y: m_DamagedRows) {
+        m_DamagedFrom[y] = INT_MAX;
+        m_DamagedTo[y] = -1;
+    }
+    m_DamagedRows.clear();
+    m_AllDamaged = false;
 }
 
-void CRenderer::switch_active_buffer() {
-    m_CurrentBufferId = !m_CurrentBufferId;
+void CRenderer::start_recording(std::shared_ptr<CFrameRecorder> recorder) {
+    m_Recorder = std::move(recorder);
+    damage_all();
 }
 
-void CRenderer::clear_active_buffer() {
-    current_buffer().clear();
+void CRenderer::record_frame() {
+    if (!m_Recorder)
+        return;
+    
+    if (m_AllDamaged || m_Recorder->is_keyframe_due()) {
+        m_Recorder->record_keyframe(m_Frame);
+        return;
+    }
+    
+    // Only the damaged ranges could have changed since the last frame, the rows have been sorted from the top.
+    m_Recorder->begin_delta_frame();
+    for (int y: m_DamagedRows) {
+        m_Recorder->record_changes_in_row(m_Frame, y, m_DamagedFrom[y], m_DamagedTo[y]);
+    }
+    m_Recorder->end_delta_frame();
 }
 
 void CRenderer::prepare_to_render(const CObject& objectToRender) {
-    put_sprite_at(objectToRender.get_sprite(), objectToRender.get_position());
+    put_sprite_at(objectToRender.get_sprite_id(), objectToRender.get_position());
 }
 
 void CRenderer::reset() {
-    m_Buffers[0].clear();
-    m_Buffers[1].clear();
-    m_InitialRender = true;
-}
-
-void CRenderer::do_initial_render(std::ostream& os) const {
-    
-    // Go through all possible positions and render default sprite.
-    for (int y = 0; y < m_ScreenHeight; ++y) {
-        for (int x = 0; x < m_ScreenWidth; ++x) {
-            CPosition currentPos(x, y);
-            render_sprite_at(m_DefaultVisualBlock, currentPos, os);
-        }
-    }
+    damage_all();
 }
@@ -6,13 +6,25 @@
 #include "CTerminal.h"
 #include "CUtilities.h"
 #include "CPosition.h"
-#include <map>
+#include "CFrameBuffer.h"
+#include "CFrameRecorder.h"
+#include "CRenderPipeline.h"
+#include <memory>
+#include <vector>
+#include <climits>
+#include <cstdint>
 
 /// @brief Class that renders objects to the screen.
-///        Each iteration of the game, objects are registered for rendering
-///        and then rendered. Instance of this class stores how the
-///        game looked on the previous frame and only renderers the differences
-///        between the frames.
+///        Sprites are kept in two layers. The static layer holds the environment (walls), it is rasterised
+///        once and then changes only when an environment object changes. The dynamic layer holds moving objects
+///        and bonuses and is drawn over the static layer. Sprites are put into the layers only for the cells
+///        that have changed (see 'CWorldMap::push_changes_to_render()') and only these cells are composed
+///        into the frame that should be shown.
+///        The renderer remembers which range of each row has been touched (damaged) since the last exported frame.
+///        Only the damaged rows are copied into the snapshot of the frame and the damaged ranges are published
+///        with it, so the render thread compares only them with what the screen shows (see CRenderPipeline).
+///        The frames can also be recorded (see 'start_recording()'), the damaged ranges tell the recorder
+///        which cells could have changed, so recording costs about as much as the changes themselves.
 class CRenderer {
 public:
     
@@ -23,61 +35,75 @@ public:
     ///                   the background - color for when there is no object present.
     CRenderer(int screenWidth, int screenHeight, const CConfig& config);
     
-    /// Pushes a sprite into a buffer so it can be rendered later.
+    /// Pushes a sprite into the dynamic layer so it can be rendered later.
     /// @param[in] sprite Color and text in the sprite.
     /// @param[in] position Position where the %sprite should be rendered at.
     void put_sprite_at(const CVisualBlock& sprite, const CPosition& position);
     
-    /// Pushes an object sprite into a buffer so it can be rendered later.
-    /// It gets its looks by calling CObject::get_sprite() and its position by
+    /// Pushes a sprite interned in CSpritePalette into the dynamic layer so it can be rendered later.
+    /// @param[in] sprite ID of the sprite.
+    /// @param[in] position Position where the %sprite should be rendered at.
+    void put_sprite_at(CSpritePalette::SpriteId sprite, const CPosition& position);
+    
+    /// Pushes an object sprite into the dynamic layer so it can be rendered later.
+    /// It gets its looks by calling CObject::get_sprite_id() and its position by
     ///  CObject::get_position().
     /// See put_sprite_at() for more info.
     /// @param[in] objectToRender Object that should be registered for rendering later.
     void prepare_to_render(const CObject& objectToRender);
     
-    /// Renderers the differences between the previous and current frame by
-    /// comparing the two internal buffers.
-    /// @param[in] os Stream to render the contents into.
-    void render_differences(std::ostream& os);
+    /// Removes the sprite from a cell of the dynamic layer, so objects can be put into it again.
+    /// @param[in] position Position of the cell.
+    void clear_cell(const CPosition& position);
     
-    /// Clears the active buffer of the renderer.
-    /// This method is supposed to be called before any objects are pushed
-    /// to be rendered in the next frame.
-    void clear_active_buffer();
+    /// Pushes an object sprite into the static layer. It stays there until 'clear_static_cell()' gets called.
+    /// @param[in] objectToRender Object that should be rendered (usually a part of the environment).
+    void prepare_static_to_render(const CObject& objectToRender);
     
-    /// Switches which buffer is currently considered active.
-    /// When sprites are pushed to render, they are stored in the active buffer.
-    void switch_active_buffer();
+    /// Puts the default sprite (background) into a cell of the static layer.
+    /// @param[in] position Position of the cell.
+    void clear_static_cell(const CPosition& position);
     
-    /// Clears contents of both buffers.
-    /// This method can be called in the case the rendering somehow breaks,
-    /// so everything will be rendered (not just the differences).
+    /// Marks the whole frame as damaged, so the next exported frame is published and recorded as a whole.
     void reset();
+    
+    /// Brings the frame of %snapshot up to date and publishes the damaged ranges in it, then forgets them.
+    /// Only the rows that changed since the frame of the snapshot was exported are copied.
+    /// @param[in, out] snapshot Snapshot of the same size as the screen that holds a frame exported
+    ///                          earlier by this renderer (or the background).
+    void export_frame(CRenderPipeline::CSnapshot& snapshot);
+    
+    /// @return ID of the sprite shown where there is no object.
+    [[nodiscard]] CSpritePalette::SpriteId get_background() const;
+    
+    /// Starts recording of the frames. Every frame rendered or exported from now on is recorded.
+    /// @param[in] recorder Recorder of the frames with the size of the screen.
+    void start_recording(std::shared_ptr<CFrameRecorder> recorder);
 
 private:
     
-    /// Static method for rendering sprite at some position.
-    /// Calls render_sprite() method for the actual rendering.
-    /// @param[in] sprite Sprite to be rendered.
-    /// @param[in] position Position in which the sprite should be rendered in.
-    /// @param[in] os Stream to render the sprite into.
-    static void render_sprite_at(const CVisualBlock& sprite, const CPosition& position, std::ostream& os);
+    /// Buffers are flat arrays of sprite IDs.
+    typedef CFrameBuffer Buffer;
+    
+    /// Sets a cell of a layer and composes the cell of %m_Frame from the layers.
+    /// @param[in, out] layer Layer to set the cell in.
+    /// @param[in] sprite Sprite to set.
+    /// @param[in] position Position of the cell, positions outside of the screen are ignored.
+    void set_layer_cell(Buffer& layer, CSpritePalette::SpriteId sprite, const CPosition& position);
     
-    /// Static method for rendering one sprite to an output stream.
-    /// @param[in] sprite Sprite to be rendered.
-    /// @param[in] os Stream to render the sprite into.
-    static void render_sprite(const CVisualBlock& sprite, std::ostream& os);
+    /// Adds a cell to the damaged range of its row.
+    /// @param[in] x X coordinate of the cell.
+    /// @param[in] y Y coordinate of the cell.
+    void damage(int x, int y);
     
-    /// Renders the background so it does not need to be rendered during
-    /// regular renders.
-    /// @return os Stream to render the background into.
-    void do_initial_render(std::ostream& os) const;
+    /// Marks all cells as damaged.
+    void damage_all();
     
-    /// Buffers are just a map where the key is CPosition of the corresponding sprite.
-    typedef std::map<CPosition, CVisualBlock> Buffer;
+    /// Forgets the damaged ranges.
+    void clear_damage();
     
-    /// Used as index to determine which buffer is currently active.
-    bool m_CurrentBufferId;
+    /// Records %m_Frame if the frames are being recorded. Has to be called by 'export_frame()' before 'clear_damage()'.
+    void record_frame();
     
     /// Determines the maximum X position a object can be rendered.
     int m_ScreenWidth;
@@ -88,17 +114,36 @@ private:
     /// Sprite that is going to be rendered if there is no other object at some location.
     CVisualBlock m_DefaultVisualBlock;
     
-    /// Double buffering - only changes are rendered each frame.
-    Buffer m_Buffers[2];
+    /// ID of %m_DefaultVisualBlock in CSpritePalette.
+    CSpritePalette::SpriteId m_DefaultSprite;
+    
+    /// Static layer, cells without any object hold %m_DefaultSprite.
+    Buffer m_StaticLayer;
+    
+    /// Dynamic layer, cells without any object hold CSpritePalette::NO_SPRITE.
+    Buffer m_DynamicLayer;
+    
+    /// Frame that should be shown on the screen (the layers composed together).
+    Buffer m_Frame;
+    
+    /// First damaged cell of each row (INT_MAX if the row is not damaged).
+    std::vector<int> m_DamagedFrom;
+    
+    /// Last damaged cell of each row.
+    std::vector<int> m_DamagedTo;
+    
+    /// Y coordinates of the damaged rows.
+    std::vector<int> m_DamagedRows;
+    
+    /// Whether all cells are damaged (%m_DamagedRows is not used then).
+    bool m_AllDamaged;
     
-    /// Whether initial render should happen or not.
-    /// This bool is set to true in the constructor and then
-    /// every time 'reset()' method gets called.
-    bool m_InitialRender;
+    /// Number of the last exported frame (see CRenderPipeline::CSnapshot::m_FrameNumber).
+    uint64_t m_FrameNumber;
     
-    /// @return One buffer from %m_Buffers indexed by %m_CurrentBufferId.
-    Buffer& current_buffer();
+    /// Number of the last exported frame in which each row has been damaged.
+    std::vector<uint64_t> m_RowChangedAt;
     
-    /// @return One buffer from %m_Buffers indexed by the negation of %m_CurrentBufferId.
-    Buffer& previous_buffer();
+    /// Recorder of the frames (nullptr if the frames are not recorded).
+    std::shared_ptr<CFrameRecorder> m_Recorder;
 };
@@ -1,11 +1,11 @@
 #include "CScaredFollowerAi.h"
 
 std::shared_ptr<CEnemyAi> CScaredFollowerAi::clone() const {
-    return std::make_shared<CScaredFollowerAi>(*this);
+    return CPoolAllocator<CScaredFollowerAi>::make_shared(*this);
 }
 
 std::shared_ptr<CFollowerAi> CScaredFollowerAi::clone_as_follower() const {
-    return std::make_shared<CScaredFollowerAi>(*this);
+    return CPoolAllocator<CScaredFollowerAi>::make_shared(*this);
 }
 
 Direction::EDirection
@@ -0,0 +1,22 @@
+#include "CScriptedBot.h"
+
+CScriptedBot::CScriptedBot(const std::string& pathToScript)
+        : m_NextKey(0) {
+    std::ifstream file(pathToScript, std::ios::binary);
+    if (!file.is_open())
+        throw std::runtime_error("bot script cannot be opened");
+    
+    std::copy_if(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>(), std::back_inserter(m_Keys),
+                 [](char key) { return key != '\n' && key != '\r'; });
+    if (file.bad() || m_Keys.empty())
+        throw std::runtime_error("bot script cannot be read or it is empty");
+}
+
+void CScriptedBot::act(const CPlayer& player, const CMap& entities,
+                       const CMapJoin& environment, CActionsInputRecorder& controls) {
+    static_cast<void>(player);
+    static_cast<void>(entities);
+    static_cast<void>(environment);
+    controls.record_input(m_Keys[m_NextKey], std::chrono::steady_clock::now());
+    m_NextKey = (m_NextKey + 1) % m_Keys.size();
+}
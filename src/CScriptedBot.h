@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CBot.h"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+/// @brief Bot that presses keys given by a script. Every character of the script is the key pressed
+///        in one tick (keys without an action, like a space, mean doing nothing), line breaks are skipped.
+///        When the script ends, it starts over.
+class CScriptedBot : public CBot {
+public:
+    
+    /// Constructor of CScriptedBot.
+    /// @param[in] pathToScript Path to the script.
+    /// @throws std::runtime_error When the script cannot be read or it is empty.
+    explicit CScriptedBot(const std::string& pathToScript);
+    
+    /// Presses the next key of the script.
+    /// @param[in] player Player controlled by the bot.
+    /// @param[in] entities Map of the player and the enemies.
+    /// @param[in] environment Map of objects that block the player (walls).
+    /// @param[in, out] controls Controls of the player.
+    void act(const CPlayer& player, const CMap& entities,
+             const CMapJoin& environment, CActionsInputRecorder& controls) override;
+
+private:
+    
+    /// Keys of the script, one per tick.
+    std::vector<char> m_Keys;
+    
+    /// Index of the key pressed in the next tick.
+    size_t m_NextKey;
+};
@@ -7,10 +7,10 @@ CShotgun::CShotgun(std::string name, const CBulletObjectBuilder& bulletBuilder,
         : CGun(std::move(name), bulletBuilder, maxAmmo, fireRatePeriod, infiniteAmmo, doubleBullets) {}
 
 std::shared_ptr<CGun> CShotgun::clone() const {
-    return std::make_shared<CShotgun>(*this);
+    return CPoolAllocator<CShotgun>::make_shared(*this);
 }
 
-void CShotgun::shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
+void CShotgun::shoot(CBulletStore& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
                      const CPosition& positionOfShooting, const CMapJoin& environment,
                      VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) {
     if (!can_shoot()) return;
@@ -19,12 +19,12 @@ public:
              bool infiniteAmmo = false, bool doubleBullets = false);
     
     /// Shoots three bullet into the direction determined by arguments of this method.
-    /// @param[in, out] bullets List of bullets in the game so the gun can add bullets into in.
+    /// @param[in, out] bullets Container of bullets in the game so the gun can add bullets into in.
     /// @param[in, out] bulletMap CMap containing bullet objects in the game so the gun can add bullets into in.
     /// @param[in, out] positionOfShooting Position where the entity holding the gun currently is.
     /// @param[in, out] vOrientation VERTICAL orientation of entity holding the gun.
     /// @param[in, out] hOrientation HORIZONTAL orientation of entity holding the gun.
-    void shoot(std::list<CBullet>& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
+    void shoot(CBulletStore& bulletControllers, const std::shared_ptr<CMap>& bulletMap,
                const CPosition& positionOfShooting, const CMapJoin& environment,
                VOrientation::EVOrientation vOrientation, HOrientation::EHOrientation hOrientation) override;
     
@@ -11,16 +11,18 @@ CSimpleFollowerAi::decide_direction(const CPosition& startPosition, const CPosit
     // startPosition + direction and targetPosition.
     int shortestDistance = INT_MAX;
     Direction::EDirection bestDirection = Direction::NONE;
+    // Test all neighbouring positions at once.
+    uint32_t freeNeighbours = toAvoid.free_neighbours(startPosition);
     // Loop through all possible directions.
     for (int i = 0; i < Direction::DIRECTION_COUNT; i++) {
         
-        auto potentialDirection = static_cast<Direction::EDirection>(i);
-        CPosition potentialPosition = startPosition + potentialDirection;
-        
         // If the enemy cannot go to the new position pick a different one.
-        if (!toAvoid.can_be_stepped_on(potentialPosition))
+        if (!(freeNeighbours & (1u << i)))
             continue;
         
+        auto potentialDirection = static_cast<Direction::EDirection>(i);
+        CPosition potentialPosition = startPosition + potentialDirection;
+        
         // Calculate the distance to the targetPosition.
         int candidateDistance = manhattan_distance(potentialPosition, targetPosition);
         // Update bestDirection if it resulted in smaller or the same distance (in that case we decide randomly).
@@ -40,7 +42,7 @@ CSimpleFollowerAi::decide_direction(const CPosition& startPosition, const CPosit
     if (m_SamePositionCounter > 2 && rand() % 3) {
         // AI is stuck -> pick a random direction that does not result in collisions with environment.
         Direction::EDirection randomDirection = CUtilities::random_direction();
-        if (toAvoid.can_be_stepped_on(startPosition + randomDirection))
+        if (freeNeighbours & (1u << randomDirection))
             bestDirection = randomDirection;
     }
     
@@ -49,9 +51,9 @@ CSimpleFollowerAi::decide_direction(const CPosition& startPosition, const CPosit
 }
 
 std::shared_ptr<CEnemyAi> CSimpleFollowerAi::clone() const {
-    return std::make_shared<CSimpleFollowerAi>(*this);
+    return CPoolAllocator<CSimpleFollowerAi>::make_shared(*this);
 }
 
 std::shared_ptr<CFollowerAi> CSimpleFollowerAi::clone_as_follower() const {
-    return std::make_shared<CSimpleFollowerAi>(*this);
+    return CPoolAllocator<CSimpleFollowerAi>::make_shared(*this);
 }
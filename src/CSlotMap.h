@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CHandle.h"
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+/// @brief Container storing values in slots and giving out generational handles (see CHandle) to them.
+///        Resolving a handle is a single array lookup and a comparison of generations.
+///        Slots of erased values are reused with a new generation, so stale handles resolve to nullptr
+///        and erased values are reclaimed without any heap frees. A slot whose generations have all been
+///        used up is retired instead of being reused, so a stale handle never resolves to a different value.
+/// @tparam T Type of the stored values. A default-constructed value is kept in free slots.
+/// @warning Inserting a value may move other values, so pointers returned by this container are valid only
+///          until the next insertion. Handles stay valid until their value is erased.
+template<typename T>
+class CSlotMap {
+public:
+    
+    /// Stores a value in a free slot.
+    /// @param[in] value Value to be stored.
+    /// @return Handle to the value.
+    /// @throws std::length_error if all slots addressable by a handle are used or retired.
+    CHandle emplace(T value);
+    
+    /// @param[in] handle Handle to look up.
+    /// @return Pointer to the value %handle refers to or nullptr if the handle is null or stale.
+    [[nodiscard]] T* get(CHandle handle);
+    
+    /// @param[in] handle Handle to look up.
+    /// @return Pointer to the value %handle refers to or nullptr if the handle is null or stale.
+    [[nodiscard]] const T* get(CHandle handle) const;
+    
+    /// Erases the value %handle refers to. All handles to the value become stale.
+    /// @return Whether any value was erased (false means the handle was null or stale).
+    bool erase(CHandle handle);
+    
+    /// @return Number of stored values.
+    [[nodiscard]] size_t size() const;
+    
+    /// Erases all values. Handles given out before become stale.
+    void clear();
+
+private:
+    
+    /// Moves a slot to the next generation and makes it free (or retires it).
+    void release_slot(uint32_t slot);
+    
+    /// Value of each slot.
+    std::vector<T> m_Values;
+    
+    /// Current generation of each slot. Handles of other generations are stale.
+    std::vector<uint32_t> m_Generations;
+    
+    /// Slots that are not used by any value.
+    std::vector<uint32_t> m_FreeSlots;
+    
+    /// Number of stored values.
+    size_t m_Size = 0;
+};
+
+template<typename T>
+CHandle CSlotMap<T>::emplace(T value) {
+    uint32_t slot;
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        m_Values[slot] = std::move(value);
+    } else {
+        if (m_Values.size() >= CHandle::MAX_SLOTS)
+            throw std::length_error("slot map is full");
+        slot = static_cast<uint32_t>(m_Values.size());
+        m_Values.emplace_back(std::move(value));
+        m_Generations.emplace_back(1);
+    }
+    m_Size++;
+    return CHandle(slot, m_Generations[slot]);
+}
+
+template<typename T>
+T* CSlotMap<T>::get(CHandle handle) {
+    uint32_t slot = handle.index();
+    if (handle.is_null() || slot >= m_Values.size() || m_Generations[slot] != handle.generation())
+        return nullptr;
+    return &m_Values[slot];
+}
+
+template<typename T>
+const T* CSlotMap<T>::get(CHandle handle) const {
+    uint32_t slot = handle.index();
+    if (handle.is_null() || slot >= m_Values.size() || m_Generations[slot] != handle.generation())
+        return nullptr;
+    return &m_Values[slot];
+}
+
+template<typename T>
+bool CSlotMap<T>::erase(CHandle handle) {
+    if (get(handle) == nullptr)
+        return false;
+    // Take the value out first, so its destructor does not see a half-erased container.
+    [[maybe_unused]] T value = std::move(m_Values[handle.index()]);
+    release_slot(handle.index());
+    m_Size--;
+    return true;
+}
+
+template<typename T>
+size_t CSlotMap<T>::size() const {
+    return m_Size;
+}
+
+template<typename T>
+void CSlotMap<T>::clear() {
+    std::vector<T> values = std::move(m_Values);
+    m_Values.assign(values.size(), T());
+    m_FreeSlots.clear();
+    for (uint32_t slot = static_cast<uint32_t>(m_Values.size()); slot-- > 0;)
+        release_slot(slot);
+    m_Size = 0;
+}
+
+template<typename T>
+void CSlotMap<T>::release_slot(uint32_t slot) {
+    // A new generation makes all handles to the slot stale. Generation zero is reserved for null handles,
+    // so a slot that ran out of generations is not reused at all.
+    if (++m_Generations[slot] < CHandle::GENERATION_COUNT)
+        m_FreeSlots.emplace_back(slot);
+}
@@ -0,0 +1,55 @@
+#include "CSpritePalette.h"
+
+std::unique_ptr<CVisualBlock[]> CSpritePalette::m_Chunks[MAX_CHUNKS];
+
+size_t CSpritePalette::m_Size = 0;
+
+std::vector<CSpritePalette::SpriteId> CSpritePalette::m_HurtVariants;
+
+std::map<CVisualBlock, CSpritePalette::SpriteId> CSpritePalette::m_Ids;
+
+CSpritePalette::SpriteId CSpritePalette::intern(const CVisualBlock& sprite) {
+    auto it = m_Ids.find(sprite);
+    if (it != m_Ids.end()) {
+        return it->second;
+    }
+    
+    SpriteId id = store(sprite);
+    
+    // Hurt variant of the sprite is interned as well. Sprites that already have the hurt background
+    // are their own hurt variants.
+    CVisualBlock hurtSprite = sprite;
+    hurtSprite.m_BackgroundColor = HURT_BACKGROUND;
+    auto hurtIt = m_Ids.find(hurtSprite);
+    SpriteId hurtId = hurtIt != m_Ids.end() ? hurtIt->second : store(hurtSprite);
+    m_HurtVariants[id] = hurtId;
+    m_HurtVariants[hurtId] = hurtId;
+    return id;
+}
+
+const CVisualBlock& CSpritePalette::get(SpriteId id) {
+    return m_Chunks[id / CHUNK_SIZE][id % CHUNK_SIZE];
+}
+
+CSpritePalette::SpriteId CSpritePalette::hurt_variant(SpriteId id) {
+    return m_HurtVariants[id];
+}
+
+size_t CSpritePalette::size() {
+    return m_Size;
+}
+
+CSpritePalette::SpriteId CSpritePalette::store(const CVisualBlock& sprite) {
+    if (m_Size == CHUNK_SIZE * MAX_CHUNKS) {
+        throw std::length_error("too many sprites");
+    }
+    auto id = static_cast<SpriteId>(m_Size++);
+    std::unique_ptr<CVisualBlock[]>& chunk = m_Chunks[id / CHUNK_SIZE];
+    if (chunk == nullptr) {
+        chunk = std::make_unique<CVisualBlock[]>(CHUNK_SIZE);
+    }
+    chunk[id % CHUNK_SIZE] = sprite;
+    m_HurtVariants.push_back(id);
+    m_Ids.emplace(sprite, id);
+    return id;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CVisualBlock.h"
+#include "EColor.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <map>
+#include <stdexcept>
+
+/// @brief Static class interning all sprites used in the game.
+///        Each distinct CVisualBlock is stored once and gets a 32-bit ID, so objects and frame buffers
+///        carry just the ID instead of a copy of the sprite, and sprites are compared by comparing IDs.
+///        Every sprite also has a precomputed sibling - its hurt variant (with red background).
+///        Sprites are stored in chunks that never move and the directory of the chunks has a fixed size,
+///        so 'get()' can be called from another thread (see CRenderPipeline) while new sprites are interned,
+///        as long as the ID was handed over to that thread after interning.
+///        All other methods can only be called from one thread.
+class CSpritePalette {
+public:
+    /// This class is static so the constructor is deleted.
+    CSpritePalette() = delete;
+    
+    /// ID of an interned sprite.
+    typedef uint32_t SpriteId;
+    
+    /// ID that no sprite gets. Marks places without any sprite.
+    static constexpr SpriteId NO_SPRITE = UINT32_MAX;
+    
+    /// Background color of sprites of hurt objects.
+    static constexpr Color::EColor HURT_BACKGROUND = Color::RED;
+    
+    /// Interns a sprite and its hurt variant. Interning the same sprite again returns the same ID.
+    /// Sprites should be interned when they are loaded (configuration, level), not every frame.
+    /// @param[in] sprite Sprite to intern.
+    /// @return ID of %sprite.
+    /// @throws std::length_error if there is no space for another sprite.
+    static SpriteId intern(const CVisualBlock& sprite);
+    
+    /// Interns a list of sprites (see 'intern()').
+    /// @param[in] sprites Sprites to intern.
+    /// @return IDs of %sprites in the same order.
+    template<typename Container>
+    static std::vector<SpriteId> intern_all(const Container& sprites);
+    
+    /// @param[in] id ID returned by 'intern()'.
+    /// @return The interned sprite. The reference stays valid for the whole run of the program.
+    static const CVisualBlock& get(SpriteId id);
+    
+    /// @param[in] id ID returned by 'intern()'.
+    /// @return ID of the sprite that is shown when an object with sprite %id is hurt.
+    static SpriteId hurt_variant(SpriteId id);
+    
+    /// @return Number of interned sprites.
+    static size_t size();
+
+private:
+    
+    /// Stores a new sprite without checking if it has already been interned.
+    /// @param[in] sprite Sprite to store.
+    /// @return ID of the stored sprite.
+    static SpriteId store(const CVisualBlock& sprite);
+    
+    /// Number of sprites in one chunk of %m_Chunks.
+    static constexpr size_t CHUNK_SIZE = 256;
+    
+    /// Maximum number of chunks in %m_Chunks.
+    static constexpr size_t MAX_CHUNKS = 4096;
+    
+    /// Interned sprites indexed by their IDs split into chunks of %CHUNK_SIZE sprites.
+    /// Chunks are never moved, so the references to sprites stay valid.
+    static std::unique_ptr<CVisualBlock[]> m_Chunks[MAX_CHUNKS];
+    
+    /// Number of interned sprites.
+    static size_t m_Size;
+    
+    /// IDs of hurt variants indexed by IDs of the sprites.
+    static std::vector<SpriteId> m_HurtVariants;
+    
+    /// IDs of interned sprites.
+    static std::map<CVisualBlock, SpriteId> m_Ids;
+};
+
+template<typename Container>
+std::vector<CSpritePalette::SpriteId> CSpritePalette::intern_all(const Container& sprites) {
+    std::vector<SpriteId> result;
+    result.reserve(sprites.size());
+    for (const CVisualBlock& sprite: sprites) {
+        result.push_back(intern(sprite));
+    }
+    return result;
+}
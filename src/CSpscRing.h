@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+/// @brief Lock-free ring buffer with a fixed capacity for one producer thread and one consumer thread.
+///        The producer only moves the tail and the consumer only moves the head, so no locks are needed -
+///        each side publishes its index with a release store and reads the other one with an acquire load.
+///        The indices grow without wrapping around and the capacity is a power of two, so a position
+///        in the ring is a single mask away.
+/// @tparam T Type of the items. Items are copied in and out, so it should be cheap to copy (like char).
+template<typename T>
+class CSpscRing {
+public:
+    
+    /// Constructor of CSpscRing.
+    /// @param[in] capacity Minimum number of items the ring can hold, it is rounded up to a power of two.
+    explicit CSpscRing(size_t capacity);
+    
+    /// The indices are shared between threads, so the ring cannot be copied.
+    CSpscRing(const CSpscRing& other) = delete;
+    
+    /// The indices are shared between threads, so the ring cannot be copied.
+    CSpscRing& operator=(const CSpscRing& other) = delete;
+    
+    /// Copies as many items as fit into the ring.
+    /// @param[in] items Items to copy.
+    /// @param[in] count Number of items in %items.
+    /// @return Number of copied items (0 if the ring is full).
+    /// @warning Can only be called from the producer thread.
+    size_t write(const T* items, size_t count);
+    
+    /// Copies as many items as there are in the ring (at most %count) out of it.
+    /// @param[out] items Memory for at least %count items.
+    /// @param[in] count Maximum number of items to copy.
+    /// @return Number of copied items (0 if the ring is empty).
+    /// @warning Can only be called from the consumer thread.
+    size_t read(T* items, size_t count);
+    
+    /// Drops all items in the ring.
+    /// @warning Can only be called from the consumer thread.
+    void clear();
+    
+    /// @return Whether the ring is empty. Exact when called from the consumer thread.
+    [[nodiscard]] bool empty() const;
+    
+    /// @return Number of items the ring can hold.
+    [[nodiscard]] size_t capacity() const;
+
+private:
+    
+    /// Memory of the ring.
+    std::vector<T> m_Items;
+    
+    /// Capacity minus one, used to turn an index into a position.
+    size_t m_Mask;
+    
+    /// Index of the next item to read. Written only by the consumer.
+    alignas(64) std::atomic<size_t> m_Head;
+    
+    /// Index of the next item to write. Written only by the producer.
+    alignas(64) std::atomic<size_t> m_Tail;
+};
+
+template<typename T>
+CSpscRing<T>::CSpscRing(size_t capacity)
+        : m_Head(0), m_Tail(0) {
+    size_t rounded = 1;
+    while (rounded < capacity)
+        rounded *= 2;
+    m_Items.resize(rounded);
+    m_Mask = rounded - 1;
+}
+
+template<typename T>
+size_t CSpscRing<T>::write(const T* items, size_t count) {
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    size_t head = m_Head.load(std::memory_order_acquire);
+    count = std::min(count, m_Items.size() - (tail - head));
+    
+    // The free space can wrap around the end of the memory.
+    size_t position = tail & m_Mask;
+    size_t firstPart = std::min(count, m_Items.size() - position);
+    std::copy(items, items + firstPart, m_Items.begin() + position);
+    std::copy(items + firstPart, items + count, m_Items.begin());
+    
+    m_Tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+size_t CSpscRing<T>::read(T* items, size_t count) {
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    size_t tail = m_Tail.load(std::memory_order_acquire);
+    count = std::min(count, tail - head);
+    
+    // The stored items can wrap around the end of the memory.
+    size_t position = head & m_Mask;
+    size_t firstPart = std::min(count, m_Items.size() - position);
+    std::copy(m_Items.begin() + position, m_Items.begin() + position + firstPart, items);
+    std::copy(m_Items.begin(), m_Items.begin() + (count - firstPart), items + firstPart);
+    
+    m_Head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+void CSpscRing<T>::clear() {
+    m_Head.store(m_Tail.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+template<typename T>
+bool CSpscRing<T>::empty() const {
+    return m_Head.load(std::memory_order_relaxed) == m_Tail.load(std::memory_order_acquire);
+}
+
+template<typename T>
+size_t CSpscRing<T>::capacity() const {
+    return m_Items.size();
+}
@@ -41,9 +41,8 @@ void CTerminal::non_blocking_input_off() {
 }
 
 std::string CTerminal::move_cursor_to(int x, int y) {
-    std::ostringstream oss;
-    oss << (y + 1) << ";" << (x + 1) << "H";
-    return ansi_command(oss.str());
+    char buffer[MAX_SEQUENCE_LENGTH];
+    return std::string(buffer, write_move_cursor_to(x, y, buffer));
 }
 
 std::string CTerminal::hide_cursor() {
@@ -59,27 +58,20 @@ std::string CTerminal::erase_entire_screen() {
 }
 
 std::string CTerminal::ansi_command(const std::string& command) {
-    std::ostringstream oss;
-    oss << ESCAPE << command;
-    return oss.str();
+    return ESCAPE + command;
 }
 
 std::string CTerminal::set_color(Color::EColor color) {
-    std::ostringstream oss;
-    oss << color << "m";
-    return ansi_command(oss.str());
+    return std::string(color_code(color));
 }
 
-char CTerminal::get_non_blocking_input() {
-    char result = no_input();
-    // Read one character from standard input using read()
+size_t CTerminal::read_non_blocking_input(char* buffer, size_t capacity) {
+    // Read the characters from standard input using read()
     // since normal methods (like operator>>) do not work.
-    ssize_t tmp = read(fileno(stdin), &result, 1);
+    ssize_t count = read(fileno(stdin), buffer, capacity);
     
-    // read() returns a value. This way we do not get a warning
-    // for unused variable.
-    static_cast<void> (tmp);
-    return result;
+    // Without any key read() fails with EAGAIN.
+    return count > 0 ? static_cast<size_t>(count) : 0;
 }
 
 void CTerminal::game_mode_on() {
@@ -90,48 +82,120 @@ void CTerminal::game_mode_on() {
 }
 
 std::string CTerminal::set_background_color(Color::EColor color) {
-    std::ostringstream oss;
-    // To get the background code from the color code
-    // we just need to add 10 to it.
-    oss << (static_cast<int>(color) + 10) << "m";
-    return ansi_command(oss.str());
+    return std::string(background_color_code(color));
 }
 
 std::string CTerminal::move_cursor_to(const CPosition& position) {
     return move_cursor_to(position.m_X * 2, position.m_Y);
 }
 
-char CTerminal::no_input() {
-    return '\0';
+void CTerminal::get_terminal_size(int& width, int& height) {
+    winsize size{};
+    ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
+    width = size.ws_col;
+    height = size.ws_row;
 }
 
-void CTerminal::wait_for_terminal_size(int width, int height) {
-    winsize size{};
+void CTerminal::print_terminal_size_prompt(int width, int height) {
+    std::cout << erase_entire_screen()
+              << move_cursor_to(0, 0)
+              << "Please make your terminal bigger (smallest possible size: "
+              << width << " x " << height
+              << ")" << std::flush;
+}
+
+void CTerminal::print_in_color(const std::string& str, Color::EColor color, std::ostream& stream) {
+    stream << set_color(color) << str << reset_graphics();
+}
+
+char* CTerminal::write_move_cursor_to(int x, int y, char* out) {
+    // "ESC[row;columnH", the column can be left out if it is the first one.
+    *out++ = ESCAPE[0];
+    *out++ = ESCAPE[1];
+    out = write_number(y + 1, out);
+    if (x != 0) {
+        *out++ = ';';
+        out = write_number(x + 1, out);
+    }
+    *out++ = 'H';
+    return out;
+}
+
+char* CTerminal::write_move_cursor_by(int distance, char direction, char* out) {
+    // Distance 1 can be left out.
+    *out++ = ESCAPE[0];
+    *out++ = ESCAPE[1];
+    if (distance != 1) {
+        out = write_number(distance, out);
+    }
+    *out++ = direction;
+    return out;
+}
+
+char* CTerminal::write_number(int value, char* out) {
+    // Digits of all two digit numbers, so two digits are converted at once.
+    static constexpr char DIGIT_PAIRS[] =
+            "0001020304050607080910111213141516171819"
+            "2021222324252627282930313233343536373839"
+            "4041424344454647484950515253545556575859"
+            "6061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
     
-    // Get terminal size and check its dimensions.
-    ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
-    bool wasSmall = false;
-    if (width > size.ws_col || height > size.ws_row) {
-        wasSmall = true;
-        std::cout << erase_entire_screen()
-                  << move_cursor_to(0, 0)
-                  << "Please make your terminal bigger (smallest possible size: "
-                  << width << " x " << height
-                  << ")" << std::flush;
+    // Write the digits from the end into a temporary buffer.
+    char digits[16];
+    char* end = digits + sizeof(digits);
+    char* begin = end;
+    auto remaining = static_cast<unsigned>(std::max(value, 0));
+    while (remaining >= 100) {
+        unsigned pair = (remaining % 100) * 2;
+        remaining /= 100;
+        *--begin = DIGIT_PAIRS[pair + 1];
+        *--begin = DIGIT_PAIRS[pair];
     }
-    while (width > size.ws_col || height > size.ws_row) {
-        ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
+    if (remaining >= 10) {
+        *--begin = DIGIT_PAIRS[remaining * 2 + 1];
+        *--begin = DIGIT_PAIRS[remaining * 2];
+    } else {
+        *--begin = static_cast<char>('0' + remaining);
     }
     
-    if (wasSmall) {
-        // The resizing can mess up rendering of characters in the terminal.
-        // This is here to try to prevent that.
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    while (begin != end) {
+        *out++ = *begin++;
     }
+    return out;
 }
 
-void CTerminal::print_in_color(const std::string& str, Color::EColor color, std::ostream& stream) {
-    stream << set_color(color) << str << reset_graphics();
+std::string_view CTerminal::color_code(Color::EColor color) {
+    return color_codes().m_Foreground[color_index(color)];
 }
 
+std::string_view CTerminal::background_color_code(Color::EColor color) {
+    return color_codes().m_Background[color_index(color)];
+}
+
+std::string_view CTerminal::colors_code(Color::EColor color, Color::EColor backgroundColor) {
+    return color_codes().m_Both[color_index(color)][color_index(backgroundColor)];
+}
 
+CTerminal::CColorCodes::CColorCodes() {
+    for (int i = 0; i < COLOR_COUNT; ++i) {
+        // To get the background code from the color code
+        // we just need to add 10 to it.
+        int code = Color::BLACK + i;
+        m_Foreground[i] = ESCAPE + std::to_string(code) + "m";
+        m_Background[i] = ESCAPE + std::to_string(code + 10) + "m";
+        for (int j = 0; j < COLOR_COUNT; ++j) {
+            m_Both[i][j] = ESCAPE + std::to_string(code) + ";" + std::to_string(Color::BLACK + j + 10) + "m";
+        }
+    }
+}
+
+const CTerminal::CColorCodes& CTerminal::color_codes() {
+    static const CColorCodes CODES;
+    return CODES;
+}
+
+int CTerminal::color_index(Color::EColor color) {
+    int index = static_cast<int>(color) - Color::BLACK;
+    return CUtilities::is_in_range(index, 0, COLOR_COUNT - 1) ? index : Color::DEFAULT - Color::BLACK;
+}
@@ -8,8 +8,12 @@
 #include <unistd.h>
 #include <iostream>
 #include <sstream>
+#include <string_view>
+#include <cstddef>
 #include "EColor.h"
 #include "CPosition.h"
+#include "CUtilities.h"
+#include <algorithm>
 
 /// @brief Static class containing helper methods for terminal (setting colors, no echo, ...)
 /// @author Almost every method here was taken from Jan Matoušek sw-tips:
@@ -43,19 +47,22 @@ public:
     /// since it is necessary for the game to work properly.
     static bool is_output_to_terminal();
     
-    /// Returns a character read from stdin when the non blocking input is on.
-    static char get_non_blocking_input();
+    /// Reads all characters waiting in stdin (at most %capacity) by one read() when the non blocking input is on.
+    /// @param[out] buffer Memory the characters are read into.
+    /// @param[in] capacity Size of %buffer.
+    /// @return Number of characters read, 0 if no key has been pressed.
+    static size_t read_non_blocking_input(char* buffer, size_t capacity);
     
-    /// Returns character that is returned by 'get_non_blocking_input()' when
-    /// no key has been pressed.
-    static char no_input();
+    /// Gets the size of the terminal.
+    /// @param[out] width Number of columns of the terminal.
+    /// @param[out] height Number of rows of the terminal.
+    static void get_terminal_size(int& width, int& height);
     
-    /// Checks the size of the terminal size and if it is smaller then required
-    /// this method acts as a little subprogram that waits for the user to
-    /// make the terminal bigger while displaying a simple prompt.
+    /// Prints a simple prompt asking the user to make the terminal bigger.
+    /// The terminal gets resized by the user, see CTtyBackend::wait_for_size().
     /// @param[in] width Minimal width of the terminal required.
     /// @param[in] height Minimal height of the terminal required.
-    static void wait_for_terminal_size(int width, int height);
+    static void print_terminal_size_prompt(int width, int height);
     
     /// Prints to an output stream a string in color and then resetting the formatting of the stream.
     /// @param[in] str String to print_stored_value to the stream.
@@ -104,8 +111,75 @@ public:
     /// @return String that when sent to an output stream changes the color of the background
     ///         of characters set to the stream later.
     [[nodiscard]] static std::string set_background_color(Color::EColor color);
+    
+    /// Maximum number of characters written by 'write_move_cursor_to()' and 'write_move_cursor_by()'.
+    static constexpr size_t MAX_SEQUENCE_LENGTH = 32;
+    
+    /// Writes the ANSI code moving the cursor to a certain position into a caller's buffer.
+    /// Unlike 'move_cursor_to()' nothing is allocated, so it is meant for the rendering of frames.
+    /// @param[in] x X Coordinate (terminal column) of position we want to move the cursor to.
+    /// @param[in] y Y Coordinate (terminal row) of position we want to move the cursor to.
+    /// @param[out] out Buffer with space for at least %MAX_SEQUENCE_LENGTH characters.
+    /// @return Pointer behind the last written character.
+    static char* write_move_cursor_to(int x, int y, char* out);
+    
+    /// Writes the ANSI code moving the cursor relatively to its position into a caller's buffer.
+    /// @param[in] distance Number of rows or columns to move by (> 0).
+    /// @param[in] direction 'A' (up), 'B' (down), 'C' (right) or 'D' (left).
+    /// @param[out] out Buffer with space for at least %MAX_SEQUENCE_LENGTH characters.
+    /// @return Pointer behind the last written character.
+    static char* write_move_cursor_by(int distance, char direction, char* out);
+    
+    /// Writes a non-negative number in decimal into a caller's buffer.
+    /// @param[in] value Number to write.
+    /// @param[out] out Buffer with space for all digits of %value.
+    /// @return Pointer behind the last written digit.
+    static char* write_number(int value, char* out);
+    
+    /// Looks up the ANSI code setting the color of characters in a table built once at startup.
+    /// @param[in] color Instance of enum EColor - color that should be set.
+    /// @return Code that when sent to an output stream changes the color of the characters.
+    [[nodiscard]] static std::string_view color_code(Color::EColor color);
+    
+    /// Looks up the ANSI code setting the color of background in a table built once at startup.
+    /// @param[in] color Instance of enum EColor - color that should be set.
+    /// @return Code that when sent to an output stream changes the color of the background.
+    [[nodiscard]] static std::string_view background_color_code(Color::EColor color);
+    
+    /// Looks up the ANSI code setting the color of characters and of background at once
+    /// in a table built once at startup.
+    /// @param[in] color Color of characters that should be set.
+    /// @param[in] backgroundColor Color of background that should be set.
+    /// @return Code that when sent to an output stream changes both colors.
+    [[nodiscard]] static std::string_view colors_code(Color::EColor color, Color::EColor backgroundColor);
 private:
     
+    /// Number of entries in the tables of color codes (ANSI color codes are from 30 to 39).
+    static constexpr int COLOR_COUNT = 10;
+    
+    /// @brief Tables of ANSI codes for all colors.
+    struct CColorCodes {
+        /// Builds all codes.
+        CColorCodes();
+        
+        /// Codes setting the color of characters indexed by 'color_index()'.
+        std::string m_Foreground[COLOR_COUNT];
+        
+        /// Codes setting the color of background indexed by 'color_index()'.
+        std::string m_Background[COLOR_COUNT];
+        
+        /// Codes setting both colors indexed by 'color_index()' of the color of characters
+        /// and of the color of background.
+        std::string m_Both[COLOR_COUNT][COLOR_COUNT];
+    };
+    
+    /// @return Tables of color codes. They are built during the first call.
+    static const CColorCodes& color_codes();
+    
+    /// @param[in] color Instance of enum EColor.
+    /// @return Index of %color in the tables of CColorCodes.
+    static int color_index(Color::EColor color);
+    
     /// Helper method for creating a general ANSI code.
     /// @param[in] command The code of the ANSI command (without the escape symbol and '['
     ///                    - that is added by this method).
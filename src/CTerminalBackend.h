@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CTerminal.h"
+#include <ostream>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cstddef>
+
+/// @brief Abstract class for the terminal the game is played in. Everything the game does with the terminal
+///        during a level (waiting for its size, reading keys, writing frames) goes through it, so the game loop
+///        does not care whether there is a real terminal (see CTtyBackend) or not (see CNullBackend and
+///        CCountingBackend). The cost of every rendered frame is reported here as well.
+class CTerminalBackend {
+public:
+    
+    /// Virtual destructor since this is a base class of polymorphic classes.
+    virtual ~CTerminalBackend();
+    
+    /// Creates a backend by its name.
+    /// @param[in] name "tty", "null" or "counting".
+    /// @return New backend or nullptr if there is no backend with such a name.
+    [[nodiscard]] static std::shared_ptr<CTerminalBackend> create(const std::string& name);
+    
+    /// @return Whether a player sits in front of the terminal. The game waits between ticks
+    ///         only for interactive backends, the others run the game as fast as possible.
+    [[nodiscard]] virtual bool is_interactive() const = 0;
+    
+    /// Waits until the terminal is big enough for a level.
+    /// @param[in] width Minimal width of the terminal required.
+    /// @param[in] height Minimal height of the terminal required.
+    /// @return Whether the terminal was too small, so the game had to wait.
+    virtual bool wait_for_size(int width, int height) = 0;
+    
+    /// Prepares the terminal for the game (clears it, hides the cursor, turns on non-blocking input).
+    virtual void game_mode_on() = 0;
+    
+    /// Resets the terminal to its original state after the game.
+    virtual void reset() = 0;
+    
+    /// Reads characters of pressed keys at once, without waiting. Called from the input thread of CInputManager.
+    /// @param[out] buffer Memory the characters are read into.
+    /// @param[in] capacity Size of %buffer.
+    /// @return Number of characters read, less than %capacity means there are no more keys.
+    virtual size_t read_input(char* buffer, size_t capacity) = 0;
+    
+    /// Blocks until a key can be read by 'read_input()' or 'interrupt_input_wait()' gets called.
+    /// Called from the input thread of CInputManager.
+    virtual void wait_for_input() = 0;
+    
+    /// Makes the current (or the next) call of 'wait_for_input()' return. Can be called from any thread.
+    virtual void interrupt_input_wait() = 0;
+    
+    /// Blocks until 'notify_event()' gets called, the terminal gets resized or %deadline passes,
+    /// whatever comes first. The keys are read by the input thread, which calls 'notify_event()'.
+    /// @param[in] deadline When to stop waiting (std::chrono::steady_clock::time_point::max() means never).
+    virtual void wait_for_event(std::chrono::steady_clock::time_point deadline) = 0;
+    
+    /// Makes the current (or the next) call of 'wait_for_event()' return. Called from the input thread
+    /// of CInputManager when it has read keys.
+    virtual void notify_event() = 0;
+    
+    /// @return Whether the terminal has been resized since the last call.
+    virtual bool take_resize() = 0;
+    
+    /// Writes encoded frames into the terminal. Called from the output thread of CRenderPipeline.
+    /// @param[in] data Bytes to write.
+    /// @param[in] size Number of bytes to write.
+    /// @return False if the terminal cannot be written into (for example it has hung up).
+    ///         The failure is permanent, every later call fails too.
+    virtual bool write(const char* data, size_t size) = 0;
+    
+    /// Reports the cost of one rendered frame. Called from the render thread of CRenderPipeline.
+    /// Does nothing by default.
+    /// @param[in] cells Number of cells that had to be encoded.
+    /// @param[in] bytes Number of bytes the frame has been encoded into.
+    virtual void record_frame(size_t cells, size_t bytes);
+    
+    /// Prints what the backend has found out about the rendering. Prints nothing by default.
+    /// Should only be called when no CRenderPipeline uses the backend.
+    /// @param[in, out] os Stream to print into.
+    virtual void print_statistics(std::ostream& os) const;
+};
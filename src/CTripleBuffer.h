@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/// @brief Lock-free triple buffer passing the latest value from one producer thread to one consumer thread.
+///        The producer fills the back slot and publishes it, the consumer takes the latest published slot.
+///        The slots are swapped by a single atomic exchange of the middle slot, so neither side ever waits
+///        for the other one. Values published while the consumer is busy are overwritten by newer ones,
+///        which is what a renderer wants - it always shows the newest frame and skips the rest.
+/// @tparam T Type of the values. Slots are reused, so a value should be filled in place
+///           (for example by assignment that does not allocate).
+template<typename T>
+class CTripleBuffer {
+public:
+    
+    /// Constructor of CTripleBuffer.
+    /// @param[in] initial Value that all three slots are initialized to.
+    explicit CTripleBuffer(const T& initial);
+    
+    /// The slots are shared between threads, so the buffer cannot be copied.
+    CTripleBuffer(const CTripleBuffer& other) = delete;
+    
+    /// The slots are shared between threads, so the buffer cannot be copied.
+    CTripleBuffer& operator=(const CTripleBuffer& other) = delete;
+    
+    /// @return Slot the producer fills before calling 'publish()'. It may hold any of the previous values.
+    /// @warning Can only be called from the producer thread.
+    T& back();
+    
+    /// Publishes the back slot, so the consumer can take it, and takes another slot as the back slot.
+    /// @warning Can only be called from the producer thread.
+    void publish();
+    
+    /// @return Whether the last published value has not been taken by the consumer yet.
+    ///         A producer that must not skip any value waits until this is false before publishing.
+    /// @warning Can only be called from the producer thread.
+    [[nodiscard]] bool is_published_pending() const;
+    
+    /// Takes the latest published value, if there is one the consumer has not taken yet.
+    /// @return Whether 'front()' holds a new value.
+    /// @warning Can only be called from the consumer thread.
+    bool update();
+    
+    /// @return Latest value taken by 'update()'.
+    /// @warning Can only be called from the consumer thread.
+    const T& front() const;
+
+private:
+    
+    /// Bit of %m_Middle set when the middle slot holds a value the consumer has not taken yet.
+    static constexpr uint8_t FRESH = 4;
+    
+    /// Mask of the index of a slot in %m_Middle.
+    static constexpr uint8_t INDEX_MASK = 3;
+    
+    /// The three slots.
+    T m_Slots[3];
+    
+    /// Index of the slot filled by the producer.
+    alignas(64) uint8_t m_Back;
+    
+    /// Index of the slot read by the consumer.
+    alignas(64) uint8_t m_Front;
+    
+    /// Index of the slot in the middle, combined with %FRESH.
+    alignas(64) std::atomic<uint8_t> m_Middle;
+};
+
+template<typename T>
+CTripleBuffer<T>::CTripleBuffer(const T& initial)
+        : m_Slots{initial, initial, initial}, m_Back(0), m_Front(1), m_Middle(2) {}
+
+template<typename T>
+T& CTripleBuffer<T>::back() {
+    return m_Slots[m_Back];
+}
+
+template<typename T>
+void CTripleBuffer<T>::publish() {
+    // Release the written slot and take the previous middle slot (the consumer is not reading it).
+    m_Back = m_Middle.exchange(m_Back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+template<typename T>
+bool CTripleBuffer<T>::is_published_pending() const {
+    return m_Middle.load(std::memory_order_acquire) & FRESH;
+}
+
+template<typename T>
+bool CTripleBuffer<T>::update() {
+    if (!(m_Middle.load(std::memory_order_relaxed) & FRESH))
+        return false;
+    
+    // Give the slot read so far to the producer and acquire the published one.
+    m_Front = m_Middle.exchange(m_Front, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+}
+
+template<typename T>
+const T& CTripleBuffer<T>::front() const {
+    return m_Slots[m_Front];
+}
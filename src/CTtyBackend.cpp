@@ -0,0 +1,145 @@
+#include "CTtyBackend.h"
+
+CTtyBackend::CTtyBackend()
+        : m_SignalFd(-1), m_TimerFd(-1), m_EventFd(-1), m_InputInterruptFd(-1), m_InputClosed(false), m_Resized(false),
+          m_WriteFailed(false) {
+    // Resizes are received through a file descriptor, so they can be waited for together with the keys.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGWINCH);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    
+    m_SignalFd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    m_TimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    m_EventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_InputInterruptFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_SignalFd < 0 || m_TimerFd < 0 || m_EventFd < 0 || m_InputInterruptFd < 0) {
+        for (int fd: {m_SignalFd, m_TimerFd, m_EventFd, m_InputInterruptFd}) {
+            if (fd >= 0)
+                close(fd);
+        }
+        throw std::runtime_error("cannot create file descriptors for waiting on the terminal");
+    }
+}
+
+CTtyBackend::~CTtyBackend() {
+    close(m_SignalFd);
+    close(m_TimerFd);
+    close(m_EventFd);
+    close(m_InputInterruptFd);
+}
+
+bool CTtyBackend::is_interactive() const {
+    return true;
+}
+
+bool CTtyBackend::wait_for_size(int width, int height) {
+    int columns, rows;
+    CTerminal::get_terminal_size(columns, rows);
+    if (width <= columns && height <= rows)
+        return false;
+    
+    // Every resize wakes the waiting up, the prompt is shown until the terminal is big enough.
+    CTerminal::print_terminal_size_prompt(width, height);
+    while (width > columns || height > rows) {
+        wait_for_event(std::chrono::steady_clock::time_point::max());
+        take_resize();
+        CTerminal::get_terminal_size(columns, rows);
+    }
+    
+    // The resizing can mess up rendering of characters in the terminal.
+    // This is here to try to prevent that.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    return true;
+}
+
+void CTtyBackend::game_mode_on() {
+    // Frames are written to the standard output directly, so the stream has to be flushed first.
+    CTerminal::game_mode_on();
+    std::cout << std::flush;
+}
+
+void CTtyBackend::reset() {
+    CTerminal::reset_terminal();
+}
+
+size_t CTtyBackend::read_input(char* buffer, size_t capacity) {
+    return CTerminal::read_non_blocking_input(buffer, capacity);
+}
+
+void CTtyBackend::wait_for_input() {
+    // poll() ignores negative file descriptors, a closed input would wake it up all the time.
+    pollfd descriptors[] = {{m_InputClosed ? -1 : STDIN_FILENO, POLLIN, 0},
+                            {m_InputInterruptFd,                POLLIN, 0}};
+    while (poll(descriptors, 2, -1) < 0 && errno == EINTR) {}
+    
+    if ((descriptors[0].revents & (POLLHUP | POLLERR | POLLNVAL)) && !(descriptors[0].revents & POLLIN))
+        m_InputClosed = true;
+    if (descriptors[1].revents & POLLIN)
+        drain_event_fd(m_InputInterruptFd);
+}
+
+void CTtyBackend::interrupt_input_wait() {
+    uint64_t increment = 1;
+    ssize_t tmp = ::write(m_InputInterruptFd, &increment, sizeof(increment));
+    static_cast<void>(tmp);
+}
+
+void CTtyBackend::wait_for_event(std::chrono::steady_clock::time_point deadline) {
+    // steady_clock measures CLOCK_MONOTONIC, so the deadline can be passed to the timer as it is.
+    // A deadline in the past makes the timer expire right away, zero disarms it.
+    itimerspec timer{};
+    if (deadline != std::chrono::steady_clock::time_point::max()) {
+        auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+        timer.it_value.tv_sec = std::max<long long>(nanoseconds, 1) / 1000000000;
+        timer.it_value.tv_nsec = std::max<long long>(nanoseconds, 1) % 1000000000;
+    }
+    timerfd_settime(m_TimerFd, TFD_TIMER_ABSTIME, &timer, nullptr);
+    
+    pollfd descriptors[] = {{m_EventFd,  POLLIN, 0},
+                            {m_SignalFd, POLLIN, 0},
+                            {m_TimerFd,  POLLIN, 0}};
+    while (poll(descriptors, 3, -1) < 0 && errno == EINTR) {}
+    
+    if (descriptors[0].revents & POLLIN)
+        drain_event_fd(m_EventFd);
+    if (descriptors[1].revents & POLLIN)
+        read_signals();
+    if (descriptors[2].revents & POLLIN) {
+        uint64_t expirations;
+        ssize_t tmp = read(m_TimerFd, &expirations, sizeof(expirations));
+        static_cast<void>(tmp);
+    }
+}
+
+void CTtyBackend::notify_event() {
+    uint64_t increment = 1;
+    ssize_t tmp = ::write(m_EventFd, &increment, sizeof(increment));
+    static_cast<void>(tmp);
+}
+
+bool CTtyBackend::take_resize() {
+    read_signals();
+    bool resized = m_Resized;
+    m_Resized = false;
+    return resized;
+}
+
+bool CTtyBackend::write(const char* data, size_t size) {
+    m_WriteFailed = m_WriteFailed || !COutputBuffer::write_all(STDOUT_FILENO, data, size);
+    return !m_WriteFailed;
+}
+
+void CTtyBackend::read_signals() {
+    signalfd_siginfo info;
+    while (read(m_SignalFd, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info))) {
+        if (info.ssi_signo == SIGWINCH)
+            m_Resized = true;
+    }
+}
+
+void CTtyBackend::drain_event_fd(int eventFd) {
+    uint64_t counter;
+    ssize_t tmp = read(eventFd, &counter, sizeof(counter));
+    static_cast<void>(tmp);
+}
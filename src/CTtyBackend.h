@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CTerminalBackend.h"
+#include "COutputBuffer.h"
+#include <unistd.h>
+#include <poll.h>
+#include <csignal>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+#include <stdexcept>
+#include <thread>
+#include <cerrno>
+
+/// @brief Backend for the terminal the program runs in. Frames are written as ANSI escape sequences
+///        to the standard output and keys are read from the standard input (see CTerminal).
+///        The input thread of CInputManager blocks in poll() over the standard input ('wait_for_input()').
+///        The game ('wait_for_event()') blocks in poll() over an eventfd written by the input thread when
+///        it reads keys, a signalfd receiving SIGWINCH (resizes of the terminal) and a timerfd armed
+///        to the deadline, so a waiting game does not use the CPU and reacts to keys and resizes immediately.
+class CTtyBackend : public CTerminalBackend {
+public:
+    
+    /// Constructor of CTtyBackend. Blocks SIGWINCH, so it is only received by the signalfd.
+    /// Has to be called before any other thread is started, since the threads inherit the blocked signals.
+    /// @throws std::runtime_error When the file descriptors cannot be created.
+    CTtyBackend();
+    
+    /// Destructor of CTtyBackend. Closes the file descriptors.
+    ~CTtyBackend() override;
+    
+    /// The file descriptors are owned by the instance, so it cannot be copied.
+    CTtyBackend(const CTtyBackend& other) = delete;
+    
+    /// The file descriptors are owned by the instance, so it cannot be copied.
+    CTtyBackend& operator=(const CTtyBackend& other) = delete;
+    
+    /// @return True, a player is playing the game.
+    [[nodiscard]] bool is_interactive() const override;
+    
+    /// If the terminal is too small, shows a prompt and waits (without spinning) for the player
+    /// to make the terminal bigger.
+    /// @param[in] width Minimal width of the terminal required.
+    /// @param[in] height Minimal height of the terminal required.
+    /// @return Whether the terminal was too small.
+    bool wait_for_size(int width, int height) override;
+    
+    /// Clears the terminal and turns on non-blocking input (see CTerminal::game_mode_on()).
+    void game_mode_on() override;
+    
+    /// Resets the terminal (see CTerminal::reset_terminal()).
+    void reset() override;
+    
+    /// Reads the characters waiting in the standard input by one read() (see CTerminal::read_non_blocking_input()).
+    /// @param[out] buffer Memory the characters are read into.
+    /// @param[in] capacity Size of %buffer.
+    /// @return Number of characters read.
+    size_t read_input(char* buffer, size_t capacity) override;
+    
+    /// Blocks in poll() until a key is pressed or 'interrupt_input_wait()' gets called.
+    /// Once the standard input is closed, only the interruption ends the waiting.
+    void wait_for_input() override;
+    
+    /// Wakes up 'wait_for_input()' through %m_InputInterruptFd.
+    void interrupt_input_wait() override;
+    
+    /// Blocks in poll() until 'notify_event()' gets called, the terminal gets resized or %deadline passes.
+    /// @param[in] deadline When to stop waiting (std::chrono::steady_clock::time_point::max() means never).
+    void wait_for_event(std::chrono::steady_clock::time_point deadline) override;
+    
+    /// Wakes up 'wait_for_event()' through %m_EventFd.
+    void notify_event() override;
+    
+    /// @return Whether SIGWINCH has been received since the last call.
+    bool take_resize() override;
+    
+    /// Writes bytes to the standard output. Once a write fails (the terminal is gone),
+    /// nothing is written anymore and the bytes are dropped.
+    /// @param[in] data Bytes to write.
+    /// @param[in] size Number of bytes to write.
+    /// @return False if this or any earlier write failed.
+    bool write(const char* data, size_t size) override;
+
+private:
+    
+    /// Reads all pending signals from %m_SignalFd and remembers whether there was a resize.
+    void read_signals();
+    
+    /// Resets the counter of an eventfd, so it does not wake up poll() again.
+    /// @param[in] eventFd The eventfd.
+    static void drain_event_fd(int eventFd);
+    
+    /// File descriptor receiving SIGWINCH.
+    int m_SignalFd;
+    
+    /// File descriptor of the timer that ends waiting at the deadline.
+    int m_TimerFd;
+    
+    /// Eventfd ending 'wait_for_event()', written by 'notify_event()'.
+    int m_EventFd;
+    
+    /// Eventfd ending 'wait_for_input()', written by 'interrupt_input_wait()'.
+    int m_InputInterruptFd;
+    
+    /// Whether the standard input has been closed (poll() reports a hangup), used only by the input thread.
+    bool m_InputClosed;
+    
+    /// Whether SIGWINCH has been received and not taken yet.
+    bool m_Resized;
+    
+    /// Whether writing to the standard output has failed, used only by the output thread.
+    bool m_WriteFailed;
+};
@@ -0,0 +1,49 @@
+#include "CVisibilityIndex.h"
+#include "CWorldMap.h"
+#include <cstdlib>
+
+CVisibilityIndex::CVisibilityIndex(Layer::LayerMask occluders)
+        : m_Occluders(occluders), m_IsValid(false), m_Version(0),
+          m_RowFrom(0), m_RowTo(0), m_ColumnFrom(0), m_ColumnTo(0) {}
+
+void CVisibilityIndex::update(const CWorldMap& world, const CPosition& target, int maxDistance) {
+    uint64_t version = world.blocking_version(m_Occluders);
+    if (m_IsValid && m_Target == target && m_Version == version)
+        return;
+    
+    // Distance to the closest occluder in a direction, cells past %maxDistance count as visible.
+    auto visibleDistance = [&](Direction::EDirection direction) {
+        int distance = world.first_blocker(m_Occluders, target, direction, maxDistance);
+        return distance < 0 ? maxDistance : distance - 1;
+    };
+    
+    m_RowFrom = target.m_X - visibleDistance(Direction::LEFT);
+    m_RowTo = target.m_X + visibleDistance(Direction::RIGHT);
+    m_ColumnFrom = target.m_Y - visibleDistance(Direction::UP);
+    m_ColumnTo = target.m_Y + visibleDistance(Direction::DOWN);
+    
+    m_Target = target;
+    m_Version = version;
+    m_IsValid = true;
+}
+
+Direction::EDirection CVisibilityIndex::direction_to_target(const CPosition& position, int range) const {
+    if (!m_IsValid || position == m_Target)
+        return Direction::NONE;
+    
+    if (position.m_Y == m_Target.m_Y && position.m_X >= m_RowFrom && position.m_X <= m_RowTo
+        && std::abs(position.m_X - m_Target.m_X) <= range) {
+        return position.m_X < m_Target.m_X ? Direction::RIGHT : Direction::LEFT;
+    }
+    
+    if (position.m_X == m_Target.m_X && position.m_Y >= m_ColumnFrom && position.m_Y <= m_ColumnTo
+        && std::abs(position.m_Y - m_Target.m_Y) <= range) {
+        return position.m_Y < m_Target.m_Y ? Direction::DOWN : Direction::UP;
+    }
+    
+    return Direction::NONE;
+}
+
+Layer::LayerMask CVisibilityIndex::get_occluders() const {
+    return m_Occluders;
+}
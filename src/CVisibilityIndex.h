@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ELayer.h"
+#include "EDirection.h"
+#include "CPosition.h"
+#include <cstdint>
+
+class CWorldMap;
+
+/// @brief Index answering whether a target (the player) can be seen along a row or a column.
+///        It keeps the segment of the target's row and the segment of the target's column that are bounded
+///        by the closest occluders (cells that cannot be stepped on in the occluding layers).
+///        The segments are recomputed only when the target moves or when the occluders change,
+///        so a query is answered by a few comparisons.
+class CVisibilityIndex {
+public:
+    
+    /// Constructor of CVisibilityIndex.
+    /// @param[in] occluders Bitmask of layers whose blocking objects cannot be seen through.
+    explicit CVisibilityIndex(Layer::LayerMask occluders);
+    
+    /// Recomputes the segments if %target has moved or the occluders have changed since the last call.
+    /// @param[in] world World to look for the occluders in.
+    /// @param[in] target Position that should be seen.
+    /// @param[in] maxDistance Maximum distance from %target to look for the occluders into.
+    void update(const CWorldMap& world, const CPosition& target, int maxDistance);
+    
+    /// @param[in] position Position to look from.
+    /// @param[in] range Maximum distance at which the target can be seen.
+    /// @return Direction in which the target is seen from %position or Direction::NONE if it cannot be seen
+    ///         (or %position is the target's position).
+    [[nodiscard]] Direction::EDirection direction_to_target(const CPosition& position, int range) const;
+    
+    /// @return Bitmask of layers whose blocking objects cannot be seen through.
+    [[nodiscard]] Layer::LayerMask get_occluders() const;
+
+private:
+    
+    /// Bitmask of layers whose blocking objects cannot be seen through.
+    Layer::LayerMask m_Occluders;
+    
+    /// Whether the segments have been computed at least once.
+    bool m_IsValid;
+    
+    /// Position of the target the segments were computed for.
+    CPosition m_Target;
+    
+    /// Version of the occluders (see 'CWorldMap::blocking_version()') the segments were computed for.
+    uint64_t m_Version;
+    
+    /// Columns of the first and the last visible cell in the target's row.
+    int m_RowFrom, m_RowTo;
+    
+    /// Rows of the first and the last visible cell in the target's column.
+    int m_ColumnFrom, m_ColumnTo;
+};
@@ -0,0 +1,18 @@
+#include "CWakeupSignal.h"
+
+CWakeupSignal::CWakeupSignal()
+        : m_Notified(false) {}
+
+void CWakeupSignal::notify() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Notified = true;
+    }
+    m_Condition.notify_one();
+}
+
+void CWakeupSignal::wait() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Condition.wait(lock, [this]() { return m_Notified; });
+    m_Notified = false;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+
+/// @brief Signal that lets a thread sleep until another thread has something for it.
+///        The data itself is passed through lock-free structures (see CTripleBuffer and CSpscRing),
+///        the signal is only used to wake the consumer up, so a waiting thread does not spin.
+///        A notification sent while nobody waits is remembered, so it cannot get lost.
+class CWakeupSignal {
+public:
+    
+    /// Default constructor of CWakeupSignal.
+    CWakeupSignal();
+    
+    /// Wakes up the waiting thread (or the next call of 'wait()' if no thread waits).
+    void notify();
+    
+    /// Blocks until 'notify()' is called, returns immediately if it has been called since the last wait.
+    void wait();
+
+private:
+    
+    /// Protects %m_Notified.
+    std::mutex m_Mutex;
+    
+    /// Used for sleeping until %m_Notified gets set.
+    std::condition_variable m_Condition;
+    
+    /// Whether 'notify()' has been called since the last 'wait()'.
+    bool m_Notified;
+};
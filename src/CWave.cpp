@@ -13,7 +13,7 @@ CWave::CWave(std::istream& stream, const CConfig& config, const std::shared_ptr<
 }
 
 bool CWave::spawn(const std::vector<CPosition>& spawnPositions,
-                  std::list<std::shared_ptr<CEnemy>>& enemies, CMap& entityMap) {
+                  CEnemyStore& enemies, CMap& entityMap) {
     if (spawnPositions.empty()) {
         return false;
     }
@@ -32,8 +32,8 @@ bool CWave::spawn(const std::vector<CPosition>& spawnPositions,
         
         // The spawn position is empty -> spawn an enemy.
         auto enemy = m_WaveSegments.front().spawn_at(spawnPosition);
-        enemies.emplace_back(enemy);
-        entityMap.add_object(enemies.back()->get_object());
+        enemies.emplace(enemy);
+        entityMap.add_object(enemy->get_object());
     }
     
     return true;
@@ -3,6 +3,7 @@
 #include "CConfig.h"
 #include "CWaveSegment.h"
 #include "CEntityFactory.h"
+#include "CEnemyStore.h"
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -33,7 +34,7 @@ public:
     /// @return Whether the wave has spawned all of the enemies.
     ///         False means it is no longer active and should be erased.
     [[nodiscard]] bool spawn(const std::vector<CPosition>& spawnPositions,
-                             std::list<std::shared_ptr<CEnemy>>& enemies, CMap& entityMap);
+                             CEnemyStore& enemies, CMap& entityMap);
 private:
     /// Individual wave segments of the wave that are used to spawn the enemies.
     std::list<CWaveSegment> m_WaveSegments;
@@ -18,7 +18,7 @@ void CWavesManager::load(std::istream& stream, const CConfig& config,
     }
 }
 
-bool CWavesManager::update(std::list<std::shared_ptr<CEnemy>>& enemies, CMap& entityMap) {
+bool CWavesManager::update(CEnemyStore& enemies, CMap& entityMap) {
     
     /// The waves manager currently tries to spawn enemies.
     if (m_Spawning) {
@@ -3,6 +3,7 @@
 #include "CConfig.h"
 #include "CWave.h"
 #include "CEntityFactory.h"
+#include "CEnemyStore.h"
 #include <sstream>
 #include <string>
 #include <iostream>
@@ -36,7 +37,7 @@ public:
     ///                       the waves manager decides to spawn an enemy.
     /// @return False if there are no more waves of enemies to spawn and all enemies them are killed.
     ///         This mean a won game. Otherwise it returns true.
-    bool update(std::list<std::shared_ptr<CEnemy>>& enemies, CMap& entityMap);
+    bool update(CEnemyStore& enemies, CMap& entityMap);
     
     /// Checks if the waves manager has been loaded properly
     /// - meaning there is nonzero number of potential spawn position for enemies.
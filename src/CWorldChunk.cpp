@@ -0,0 +1,76 @@
+#include "CWorldChunk.h"
+
+CWorldChunk::CWorldChunk()
+        : m_OccupiedLayers(), m_BlockingLayers(), m_BlockedRows(), m_BlockedColumns(),
+          m_OccupiedRows(), m_LayerCounts(), m_ObjectCount(0) {}
+
+int CWorldChunk::cell_index(const CPosition& position) {
+    // Masking the lower bits works for negative coordinates as well (two's complement).
+    return (local_coordinate(position.m_Y) << SIZE_BITS) | local_coordinate(position.m_X);
+}
+
+int CWorldChunk::chunk_coordinate(int coordinate) {
+    // Arithmetic shift rounds towards negative infinity, so negative coordinates map to negative chunks.
+    return coordinate >> SIZE_BITS;
+}
+
+int CWorldChunk::local_coordinate(int coordinate) {
+    return coordinate & (SIZE - 1);
+}
+
+void CWorldChunk::set_blocking(Layer::ELayer layer, const CPosition& position, bool isBlocking) {
+    int x = local_coordinate(position.m_X);
+    int y = local_coordinate(position.m_Y);
+    if (isBlocking) {
+        m_BlockedRows[layer][y] |= (1u << x);
+        m_BlockedColumns[layer][x] |= (1u << y);
+    } else {
+        m_BlockedRows[layer][y] &= ~(1u << x);
+        m_BlockedColumns[layer][x] &= ~(1u << y);
+    }
+}
+
+void CWorldChunk::set_occupied(Layer::ELayer layer, const CPosition& position, bool isOccupied) {
+    int x = local_coordinate(position.m_X);
+    int y = local_coordinate(position.m_Y);
+    if (isOccupied) {
+        m_OccupiedRows[layer][y] |= (1u << x);
+    } else {
+        m_OccupiedRows[layer][y] &= ~(1u << x);
+    }
+}
+
+uint32_t CWorldChunk::row_mask(int from, int to) {
+    uint32_t upTo = to >= SIZE - 1 ? ~0u : (1u << (to + 1)) - 1;
+    return upTo & (~0u << from);
+}
+
+void CWorldChunk::collect_row(Layer::ELayer layer, int localY, uint32_t bits,
+                              const CSlotMap<std::shared_ptr<CObject>>& objects,
+                              std::vector<std::shared_ptr<CObject>>& result) const {
+    bits &= m_OccupiedRows[layer][localY];
+    while (bits) {
+        // Take the lowest set bit and clear it.
+        int x = __builtin_ctz(bits);
+        bits &= bits - 1;
+        result.emplace_back(*objects.get(m_Slots[(localY << SIZE_BITS) | x][layer]));
+    }
+}
+
+uint32_t CWorldChunk::blocked_row(Layer::LayerMask layers, int localY) const {
+    uint32_t row = 0;
+    for (int l = 0; l < Layer::LAYER_COUNT; ++l) {
+        if (layers & Layer::mask_of(static_cast<Layer::ELayer>(l)))
+            row |= m_BlockedRows[l][localY];
+    }
+    return row;
+}
+
+uint32_t CWorldChunk::blocked_column(Layer::LayerMask layers, int localX) const {
+    uint32_t column = 0;
+    for (int l = 0; l < Layer::LAYER_COUNT; ++l) {
+        if (layers & Layer::mask_of(static_cast<Layer::ELayer>(l)))
+            column |= m_BlockedColumns[l][localX];
+    }
+    return column;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "ELayer.h"
+#include "CObject.h"
+#include "CHandle.h"
+#include "CSlotMap.h"
+#include "CPosition.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/// @brief Square block of cells of CWorldMap.
+///        Chunks are allocated only when an object is put into them and freed when they become empty,
+///        so the memory used by the world scales with the populated area of the level.
+///        Cells inside of the chunk are stored in row-major order.
+///        For every layer the chunk also keeps bitboards of cells that cannot be stepped on - one 32-bit word
+///        per row and one per column - so a whole row or column of the chunk can be tested at once -
+///        and bitboards of occupied cells by rows, so region queries visit only the cells that hold an object.
+class CWorldChunk {
+public:
+    
+    /// Number of bits of a coordinate that address a cell inside of a chunk.
+    static constexpr int SIZE_BITS = 5;
+    
+    /// Width and height of a chunk.
+    static constexpr int SIZE = 1 << SIZE_BITS;
+    
+    /// Number of cells in a chunk.
+    static constexpr int CELL_COUNT = SIZE * SIZE;
+    
+    /// Default constructor of CWorldChunk - all cells are empty.
+    CWorldChunk();
+    
+    /// @param[in] position Position in the world.
+    /// @return Index of the cell of %position inside of the chunk that contains it.
+    static int cell_index(const CPosition& position);
+    
+    /// @param[in] coordinate Coordinate in the world.
+    /// @return Coordinate of the chunk that contains %coordinate.
+    static int chunk_coordinate(int coordinate);
+    
+    /// @param[in] coordinate Coordinate in the world.
+    /// @return Coordinate of %coordinate inside of the chunk that contains it.
+    static int local_coordinate(int coordinate);
+    
+    /// Marks a cell as (not) blocking in the bitboards of a layer.
+    /// @param[in] layer Layer of the bitboards to update.
+    /// @param[in] position Position of the cell in the world.
+    /// @param[in] isBlocking Whether the object in the cell cannot be stepped on.
+    void set_blocking(Layer::ELayer layer, const CPosition& position, bool isBlocking);
+    
+    /// Marks a cell as (not) occupied in the bitboard of a layer.
+    /// @param[in] layer Layer of the bitboard to update.
+    /// @param[in] position Position of the cell in the world.
+    /// @param[in] isOccupied Whether there is an object in the cell.
+    void set_occupied(Layer::ELayer layer, const CPosition& position, bool isOccupied);
+    
+    /// @param[in] from First bit of the mask.
+    /// @param[in] to Last bit of the mask.
+    /// @return Mask with bits from %from to %to (both inclusive) set.
+    static uint32_t row_mask(int from, int to);
+    
+    /// Appends objects of a layer from the cells of a row selected by %bits to %result.
+    /// @param[in] layer Layer to take the objects from.
+    /// @param[in] localY Row inside of the chunk.
+    /// @param[in] bits Bits of the cells in the row to take the objects from (bit X is cell [X, %localY]).
+    /// @param[in] objects Objects of the world the handles in the cells refer to.
+    /// @param[out] result Container the objects are appended to.
+    void collect_row(Layer::ELayer layer, int localY, uint32_t bits,
+                     const CSlotMap<std::shared_ptr<CObject>>& objects,
+                     std::vector<std::shared_ptr<CObject>>& result) const;
+    
+    /// @param[in] layers Bitmask of layers to combine.
+    /// @param[in] localY Row inside of the chunk.
+    /// @return Bits of blocking cells in a row (bit X is cell [X, %localY]) of all %layers combined.
+    [[nodiscard]] uint32_t blocked_row(Layer::LayerMask layers, int localY) const;
+    
+    /// @param[in] layers Bitmask of layers to combine.
+    /// @param[in] localX Column inside of the chunk.
+    /// @return Bits of blocking cells in a column (bit Y is cell [%localX, Y]) of all %layers combined.
+    [[nodiscard]] uint32_t blocked_column(Layer::LayerMask layers, int localX) const;
+    
+    /// Bitmask of layers that have an object in the cell for every cell.
+    Layer::LayerMask m_OccupiedLayers[CELL_COUNT];
+    
+    /// Bitmask of layers whose object cannot be stepped on for every cell.
+    Layer::LayerMask m_BlockingLayers[CELL_COUNT];
+    
+    /// Handle of the object of each layer for every cell (the objects are stored in CWorldMap).
+    CHandle m_Slots[CELL_COUNT][Layer::LAYER_COUNT];
+    
+    /// Bitboards of blocking cells by rows for each layer - bit X of %m_BlockedRows[L][Y] is the cell [X, Y].
+    uint32_t m_BlockedRows[Layer::LAYER_COUNT][SIZE];
+    
+    /// Bitboards of blocking cells by columns for each layer - bit Y of %m_BlockedColumns[L][X] is the cell [X, Y].
+    uint32_t m_BlockedColumns[Layer::LAYER_COUNT][SIZE];
+    
+    /// Bitboards of occupied cells by rows for each layer - bit X of %m_OccupiedRows[L][Y] is the cell [X, Y].
+    uint32_t m_OccupiedRows[Layer::LAYER_COUNT][SIZE];
+    
+    /// Number of objects stored in the chunk in each layer.
+    int m_LayerCounts[Layer::LAYER_COUNT];
+    
+    /// Number of objects stored in the chunk in all layers together.
+    int m_ObjectCount;
+};
@@ -0,0 +1,487 @@
+#include "CWorldMap.h"
+
+CWorldMap::CWorldMap()
+        : m_ChunksX(0), m_ChunksY(0), m_TileBits(0), m_TilesX(0), m_ObjectCounts(), m_BlockingVersions(),
+          m_Visibility(Layer::mask_of(Layer::ENVIRONMENT)) {}
+
+void CWorldMap::set_dimensions(int width, int height) {
+    // Collect handles of all objects that are currently stored and place them into the new directory,
+    // so handles held outside of the world stay valid.
+    std::vector<std::pair<Layer::ELayer, CHandle>> handles;
+    for_each_chunk([&](CWorldChunk& chunk) {
+        for (int cell = 0; cell < CWorldChunk::CELL_COUNT; ++cell) {
+            for (int l = 0; l < Layer::LAYER_COUNT; ++l) {
+                if (chunk.m_OccupiedLayers[cell] & Layer::mask_of(static_cast<Layer::ELayer>(l)))
+                    handles.emplace_back(static_cast<Layer::ELayer>(l), chunk.m_Slots[cell][l]);
+            }
+        }
+    });
+    
+    // Round the number of chunks up, so the whole level is covered.
+    m_ChunksX = (std::max(width, 0) + CWorldChunk::SIZE - 1) / CWorldChunk::SIZE;
+    m_ChunksY = (std::max(height, 0) + CWorldChunk::SIZE - 1) / CWorldChunk::SIZE;
+    m_Chunks.clear();
+    m_TileBits = 0;
+    m_TilesX = 0;
+    if (m_ChunksX > 0 && m_ChunksY > 0) {
+        // Tiles are the smallest power-of-two squares covering the shorter side of the level,
+        // so padding the level to whole tiles at most doubles its shorter side and adds less than a tile to the longer one.
+        while ((1 << m_TileBits) < std::min(m_ChunksX, m_ChunksY))
+            m_TileBits++;
+        int tileSize = 1 << m_TileBits;
+        m_TilesX = (m_ChunksX + tileSize - 1) / tileSize;
+        int tilesY = (m_ChunksY + tileSize - 1) / tileSize;
+        m_Chunks.resize(static_cast<size_t>(m_TilesX) * tilesY << (2 * m_TileBits));
+    }
+    m_OutsideChunks.clear();
+    std::fill(std::begin(m_ObjectCounts), std::end(m_ObjectCounts), 0);
+    
+    // The whole level has to be rendered again.
+    for (CDirtyCells* dirtyCells: {&m_DirtyCells, &m_DirtyStaticCells}) {
+        dirtyCells->resize(width, height);
+        dirtyCells->mark_all();
+    }
+    
+    for (const auto& [layer, handle]: handles) {
+        const CObject& object = **m_Objects.get(handle);
+        place(layer, object.get_position(), handle, !object.can_be_stepped_on());
+    }
+}
+
+uint64_t CWorldMap::morton_code(uint32_t chunkX, uint32_t chunkY) {
+    // Spread bits of a coordinate, so there is a zero between each two of them.
+    auto spread = [](uint64_t value) {
+        value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+        value = (value | (value << 8)) & 0x00FF00FF00FF00FFULL;
+        value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        value = (value | (value << 2)) & 0x3333333333333333ULL;
+        value = (value | (value << 1)) & 0x5555555555555555ULL;
+        return value;
+    };
+    return spread(chunkX) | (spread(chunkY) << 1);
+}
+
+size_t CWorldMap::directory_size() const {
+    return m_Chunks.size();
+}
+
+size_t CWorldMap::directory_index(int chunkX, int chunkY) const {
+    int tileMask = (1 << m_TileBits) - 1;
+    size_t tile = static_cast<size_t>(chunkY >> m_TileBits) * m_TilesX + (chunkX >> m_TileBits);
+    return (tile << (2 * m_TileBits)) | morton_code(chunkX & tileMask, chunkY & tileMask);
+}
+
+bool CWorldMap::is_in_directory(int chunkX, int chunkY) const {
+    return chunkX >= 0 && chunkX < m_ChunksX && chunkY >= 0 && chunkY < m_ChunksY;
+}
+
+CWorldChunk* CWorldMap::find_chunk(const CPosition& position) const {
+    int chunkX = CWorldChunk::chunk_coordinate(position.m_X);
+    int chunkY = CWorldChunk::chunk_coordinate(position.m_Y);
+    if (is_in_directory(chunkX, chunkY))
+        return m_Chunks[directory_index(chunkX, chunkY)].get();
+    
+    auto it = m_OutsideChunks.find({chunkX, chunkY});
+    return it == m_OutsideChunks.end() ? nullptr : it->second.get();
+}
+
+CWorldChunk& CWorldMap::get_or_create_chunk(const CPosition& position) {
+    int chunkX = CWorldChunk::chunk_coordinate(position.m_X);
+    int chunkY = CWorldChunk::chunk_coordinate(position.m_Y);
+    std::unique_ptr<CWorldChunk>& chunk = is_in_directory(chunkX, chunkY)
+                                          ? m_Chunks[directory_index(chunkX, chunkY)]
+                                          : m_OutsideChunks[{chunkX, chunkY}];
+    if (!chunk) {
+        // Reuse a released chunk if there is one, it is already empty.
+        if (!m_SpareChunks.empty()) {
+            chunk = std::move(m_SpareChunks.back());
+            m_SpareChunks.pop_back();
+        } else {
+            chunk = std::make_unique<CWorldChunk>();
+        }
+    }
+    return *chunk;
+}
+
+void CWorldMap::release_chunk_if_empty(const CPosition& position) {
+    int chunkX = CWorldChunk::chunk_coordinate(position.m_X);
+    int chunkY = CWorldChunk::chunk_coordinate(position.m_Y);
+    if (is_in_directory(chunkX, chunkY)) {
+        std::unique_ptr<CWorldChunk>& chunk = m_Chunks[directory_index(chunkX, chunkY)];
+        if (chunk && chunk->m_ObjectCount == 0)
+            recycle_chunk(chunk);
+        return;
+    }
+    
+    auto it = m_OutsideChunks.find({chunkX, chunkY});
+    if (it != m_OutsideChunks.end() && it->second->m_ObjectCount == 0) {
+        recycle_chunk(it->second);
+        m_OutsideChunks.erase(it);
+    }
+}
+
+void CWorldMap::recycle_chunk(std::unique_ptr<CWorldChunk>& chunk) {
+    // An empty chunk has all cells cleared, so it can be kept as it is.
+    if (m_SpareChunks.size() < MAX_SPARE_CHUNKS) {
+        m_SpareChunks.push_back(std::move(chunk));
+    } else {
+        chunk.reset();
+    }
+}
+
+Layer::LayerMask CWorldMap::occupied_layers_at(const CPosition& position) const {
+    const CWorldChunk* chunk = find_chunk(position);
+    return chunk == nullptr ? 0 : chunk->m_OccupiedLayers[CWorldChunk::cell_index(position)];
+}
+
+Layer::LayerMask CWorldMap::blocking_layers_at(const CPosition& position) const {
+    const CWorldChunk* chunk = find_chunk(position);
+    return chunk == nullptr ? 0 : chunk->m_BlockingLayers[CWorldChunk::cell_index(position)];
+}
+
+uint32_t CWorldMap::free_neighbours(Layer::LayerMask layers, const CPosition& position) const {
+    const uint32_t ALL_FREE = (1u << Direction::DIRECTION_COUNT) - 1;
+    const CWorldChunk* chunk = find_chunk(position);
+    int x = CWorldChunk::local_coordinate(position.m_X);
+    int y = CWorldChunk::local_coordinate(position.m_Y);
+    
+    // Fast path - all five cells are in the same chunk, so three row words answer the whole query.
+    if (x > 0 && x < CWorldChunk::SIZE - 1 && y > 0 && y < CWorldChunk::SIZE - 1) {
+        if (chunk == nullptr)
+            return ALL_FREE;
+        uint32_t up = chunk->blocked_row(layers, y - 1);
+        uint32_t middle = chunk->blocked_row(layers, y);
+        uint32_t down = chunk->blocked_row(layers, y + 1);
+        
+        uint32_t blocked = (((middle >> x) & 1u) << Direction::NONE)
+                           | (((up >> x) & 1u) << Direction::UP)
+                           | (((down >> x) & 1u) << Direction::DOWN)
+                           | (((middle >> (x - 1)) & 1u) << Direction::LEFT)
+                           | (((middle >> (x + 1)) & 1u) << Direction::RIGHT);
+        return ~blocked & ALL_FREE;
+    }
+    
+    // The cells cross a border of a chunk -> test them one by one.
+    uint32_t result = 0;
+    for (int d = 0; d < Direction::DIRECTION_COUNT; ++d) {
+        if (!(blocking_layers_at(position + static_cast<Direction::EDirection>(d)) & layers))
+            result |= (1u << d);
+    }
+    return result;
+}
+
+int CWorldMap::first_blocker(Layer::LayerMask layers, const CPosition& from, Direction::EDirection direction,
+                             int maxDistance) const {
+    if (direction == Direction::NONE)
+        return -1;
+    
+    bool isHorizontal = direction == Direction::LEFT || direction == Direction::RIGHT;
+    bool isForward = direction == Direction::RIGHT || direction == Direction::DOWN;
+    CPosition current = from + direction;
+    int distance = 1;
+    
+    while (distance <= maxDistance) {
+        // Number of cells that can be tested in the current chunk.
+        int local = CWorldChunk::local_coordinate(isHorizontal ? current.m_X : current.m_Y);
+        int steps = std::min(isForward ? CWorldChunk::SIZE - local : local + 1, maxDistance - distance + 1);
+        
+        const CWorldChunk* chunk = find_chunk(current);
+        if (chunk != nullptr) {
+            uint32_t line = isHorizontal
+                            ? chunk->blocked_row(layers, CWorldChunk::local_coordinate(current.m_Y))
+                            : chunk->blocked_column(layers, CWorldChunk::local_coordinate(current.m_X));
+            
+            if (isForward) {
+                // Bit %local becomes bit 0, keep only the tested bits.
+                uint32_t bits = line >> local;
+                if (steps < 32) bits &= (1u << steps) - 1;
+                if (bits) return distance + __builtin_ctz(bits);
+            } else {
+                // Bit %local becomes bit 31, keep only the tested bits.
+                uint32_t bits = line << (31 - local);
+                if (steps < 32) bits &= ~0u << (32 - steps);
+                if (bits) return distance + __builtin_clz(bits);
+            }
+        }
+        
+        // Move to the first cell of the next chunk.
+        distance += steps;
+        int offset = isForward ? steps : -steps;
+        if (isHorizontal) {
+            current.m_X += offset;
+        } else {
+            current.m_Y += offset;
+        }
+    }
+    return -1;
+}
+
+std::optional<CPosition> CWorldMap::raycast(const CPosition& from, Direction::EDirection direction,
+                                           int maxDistance, Layer::LayerMask layers) const {
+    int distance = first_blocker(layers, from, direction, maxDistance);
+    if (distance < 0)
+        return std::nullopt;
+    
+    CPosition hit = from;
+    switch (direction) {
+        case Direction::UP:
+            hit.m_Y -= distance;
+            break;
+        case Direction::DOWN:
+            hit.m_Y += distance;
+            break;
+        case Direction::LEFT:
+            hit.m_X -= distance;
+            break;
+        default:
+            hit.m_X += distance;
+            break;
+    }
+    return hit;
+}
+
+uint64_t CWorldMap::blocking_version(Layer::LayerMask layers) const {
+    // Versions only grow, so their sum changes whenever any of them does.
+    uint64_t version = 0;
+    for (int l = 0; l < Layer::LAYER_COUNT; ++l) {
+        if (layers & Layer::mask_of(static_cast<Layer::ELayer>(l)))
+            version += m_BlockingVersions[l];
+    }
+    return version;
+}
+
+Direction::EDirection CWorldMap::direction_of_sight(const CPosition& position, const CPosition& target, int range) {
+    // Walls further than the size of the level from the target cannot hide anything inside of it.
+    m_Visibility.update(*this, target, std::max(range, CWorldChunk::SIZE * std::max(m_ChunksX, m_ChunksY)));
+    return m_Visibility.direction_to_target(position, range);
+}
+
+std::vector<std::shared_ptr<CObject>> CWorldMap::objects_in_radius(Layer::ELayer layer, const CPosition& center,
+                                                                  int radius) const {
+    std::vector<std::shared_ptr<CObject>> result;
+    if (radius < 0)
+        return result;
+    
+    // Every row of the diamond is narrower by one cell on each side the further it is from the center.
+    collect_objects(layer, center.m_X - radius, center.m_Y - radius, center.m_X + radius, center.m_Y + radius,
+                    [&center, radius](int y) {
+                        int halfWidth = radius - std::abs(y - center.m_Y);
+                        return std::make_pair(center.m_X - halfWidth, center.m_X + halfWidth);
+                    }, result);
+    return result;
+}
+
+std::vector<std::shared_ptr<CObject>> CWorldMap::nearest_objects(Layer::ELayer layer, const CPosition& center,
+                                                                size_t count) const {
+    std::vector<std::shared_ptr<CObject>> result;
+    if (count == 0 || m_ObjectCounts[layer] == 0)
+        return result;
+    
+    // Grow the radius until it holds enough objects. Once the radius is bigger than the level,
+    // take all objects of the layer instead of visiting more and more empty chunks outside of it.
+    int levelRadius = 2 * CWorldChunk::SIZE * std::max(m_ChunksX, m_ChunksY);
+    for (int radius = CWorldChunk::SIZE / 2; result.size() < count; radius *= 2) {
+        if (radius > levelRadius) {
+            result.clear();
+            for_each_chunk([this, layer, &result](const CWorldChunk& chunk) {
+                if (chunk.m_LayerCounts[layer] == 0) return;
+                for (int y = 0; y < CWorldChunk::SIZE; ++y)
+                    chunk.collect_row(layer, y, ~0u, m_Objects, result);
+            });
+            break;
+        }
+        result = objects_in_radius(layer, center, radius);
+    }
+    
+    // All objects outside of the radius are further than any object inside of it -> the nearest ones are in %result.
+    auto distance = [&center](const std::shared_ptr<CObject>& object) {
+        const CPosition& position = object->get_position();
+        return std::abs(position.m_X - center.m_X) + std::abs(position.m_Y - center.m_Y);
+    };
+    size_t resultSize = std::min(count, result.size());
+    std::partial_sort(result.begin(), result.begin() + resultSize, result.end(),
+                      [&distance](const std::shared_ptr<CObject>& a, const std::shared_ptr<CObject>& b) {
+                          return distance(a) < distance(b);
+                      });
+    result.resize(resultSize);
+    return result;
+}
+
+std::shared_ptr<CObject> CWorldMap::object_at(Layer::ELayer layer, const CPosition& position) const {
+    return get_object(handle_at(layer, position));
+}
+
+CHandle CWorldMap::handle_at(Layer::ELayer layer, const CPosition& position) const {
+    const CWorldChunk* chunk = find_chunk(position);
+    if (chunk == nullptr)
+        return CHandle();
+    return chunk->m_Slots[CWorldChunk::cell_index(position)][layer];
+}
+
+std::shared_ptr<CObject> CWorldMap::get_object(CHandle handle) const {
+    const std::shared_ptr<CObject>* object = m_Objects.get(handle);
+    return object == nullptr ? nullptr : *object;
+}
+
+CHandle CWorldMap::add_object(Layer::ELayer layer, const std::shared_ptr<CObject>& object) {
+    CHandle handle = m_Objects.emplace(object);
+    place(layer, object->get_position(), handle, !object->can_be_stepped_on());
+    return handle;
+}
+
+void CWorldMap::place(Layer::ELayer layer, const CPosition& position, CHandle handle, bool isBlocking) {
+    CWorldChunk& chunk = get_or_create_chunk(position);
+    int cell = CWorldChunk::cell_index(position);
+    Layer::LayerMask layerBit = Layer::mask_of(layer);
+    
+    if (!(chunk.m_OccupiedLayers[cell] & layerBit)) {
+        chunk.m_LayerCounts[layer]++;
+        chunk.m_ObjectCount++;
+        m_ObjectCounts[layer]++;
+    }
+    
+    // The overwritten object is not referenced by any cell anymore.
+    CHandle overwritten = chunk.m_Slots[cell][layer];
+    chunk.m_Slots[cell][layer] = handle;
+    chunk.m_OccupiedLayers[cell] |= layerBit;
+    dirty_cells_of(layer).mark(position);
+    chunk.set_occupied(layer, position, true);
+    if (isBlocking || (chunk.m_BlockingLayers[cell] & layerBit))
+        m_BlockingVersions[layer]++;
+    if (isBlocking) {
+        chunk.m_BlockingLayers[cell] |= layerBit;
+    } else {
+        chunk.m_BlockingLayers[cell] &= ~layerBit;
+    }
+    chunk.set_blocking(layer, position, isBlocking);
+    if (overwritten != handle)
+        m_Objects.erase(overwritten);
+}
+
+CHandle CWorldMap::take(Layer::ELayer layer, const CPosition& position) {
+    CWorldChunk* chunk = find_chunk(position);
+    int cell = CWorldChunk::cell_index(position);
+    Layer::LayerMask layerBit = Layer::mask_of(layer);
+    if (chunk == nullptr || !(chunk->m_OccupiedLayers[cell] & layerBit))
+        return CHandle();
+    
+    CHandle handle = chunk->m_Slots[cell][layer];
+    chunk->m_Slots[cell][layer] = CHandle();
+    chunk->m_OccupiedLayers[cell] &= ~layerBit;
+    dirty_cells_of(layer).mark(position);
+    chunk->set_occupied(layer, position, false);
+    if (chunk->m_BlockingLayers[cell] & layerBit)
+        m_BlockingVersions[layer]++;
+    chunk->m_BlockingLayers[cell] &= ~layerBit;
+    chunk->set_blocking(layer, position, false);
+    chunk->m_LayerCounts[layer]--;
+    chunk->m_ObjectCount--;
+    m_ObjectCounts[layer]--;
+    release_chunk_if_empty(position);
+    return handle;
+}
+
+bool CWorldMap::erase_object_at(Layer::ELayer layer, const CPosition& position) {
+    // Erasing a null handle (empty cell) does nothing.
+    return m_Objects.erase(take(layer, position));
+}
+
+void CWorldMap::erase_object(Layer::ELayer layer, const std::shared_ptr<CObject>& object) {
+    if (object_at(layer, object->get_position()) == object)
+        erase_object_at(layer, object->get_position());
+}
+
+void CWorldMap::update_position_of_object_at(Layer::ELayer layer, const CPosition& position) {
+    CHandle handle = handle_at(layer, position);
+    const std::shared_ptr<CObject>* object = m_Objects.get(handle);
+    if (object == nullptr) {
+        throw std::out_of_range("no object to update at position");
+    }
+    
+    if ((*object)->get_position() != position) {
+        // Place the object first, so a chunk is not freed and allocated again when the object moves inside of it.
+        // The handle moves with the object, so it stays valid.
+        place(layer, (*object)->get_position(), handle, !(*object)->can_be_stepped_on());
+        take(layer, position);
+    } else {
+        // The object has not moved, but it could have turned around.
+        dirty_cells_of(layer).mark(position);
+    }
+}
+
+bool CWorldMap::try_dealing_damage_at(Layer::LayerMask layers, int damagePoints, const CPosition& position,
+                                      const CObject* exception) {
+    bool wasDamageDealt = false;
+    for (int l = 0; l < Layer::LAYER_COUNT; ++l) {
+        auto layer = static_cast<Layer::ELayer>(l);
+        
+        // The cell has to be looked up for every layer, since destroying an object can free its chunk.
+        if (!(layers & occupied_layers_at(position) & Layer::mask_of(layer)))
+            continue;
+        
+        // Keep the object alive in case it gets erased from its slot.
+        std::shared_ptr<CObject> candidate = object_at(layer, position);
+        if (candidate.get() == exception)
+            continue;
+        
+        if (candidate->deal_damage(damagePoints, m_HurtObjects))
+            erase_object(layer, candidate);
+        wasDamageDealt = true;
+    }
+    return wasDamageDealt;
+}
+
+void CWorldMap::push_objects_to_render(Layer::ELayer layer, CRenderer& renderer) const {
+    if (m_ObjectCounts[layer] == 0)
+        return;
+    
+    Layer::LayerMask layerBit = Layer::mask_of(layer);
+    for_each_chunk([&](const CWorldChunk& chunk) {
+        if (chunk.m_LayerCounts[layer] == 0)
+            return;
+        for (int cell = 0; cell < CWorldChunk::CELL_COUNT; ++cell) {
+            if (chunk.m_OccupiedLayers[cell] & layerBit)
+                renderer.prepare_to_render(**m_Objects.get(chunk.m_Slots[cell][layer]));
+        }
+    });
+}
+
+void CWorldMap::mark_dirty(const CPosition& position) {
+    // The layer of the changed object is not known.
+    m_DirtyCells.mark(position);
+    m_DirtyStaticCells.mark(position);
+}
+
+void CWorldMap::push_changes_to_render(CRenderer& renderer) {
+    m_DirtyStaticCells.for_each([&](const CPosition& position) {
+        std::shared_ptr<CObject> object = object_at(STATIC_LAYER, position);
+        if (object != nullptr) {
+            renderer.prepare_static_to_render(*object);
+        } else {
+            renderer.clear_static_cell(position);
+        }
+    });
+    m_DirtyStaticCells.clear();
+    
+    m_DirtyCells.for_each([&](const CPosition& position) {
+        renderer.clear_cell(position);
+        
+        const CWorldChunk* chunk = find_chunk(position);
+        if (chunk == nullptr)
+            return;
+        int cell = CWorldChunk::cell_index(position);
+        for (Layer::ELayer layer: DYNAMIC_RENDER_ORDER) {
+            if (chunk->m_OccupiedLayers[cell] & Layer::mask_of(layer))
+                renderer.prepare_to_render(**m_Objects.get(chunk->m_Slots[cell][layer]));
+        }
+    });
+    m_DirtyCells.clear();
+}
+
+CHurtObjectsRegistry& CWorldMap::get_hurt_objects() {
+    return m_HurtObjects;
+}
+
+CDirtyCells& CWorldMap::dirty_cells_of(Layer::ELayer layer) {
+    return layer == STATIC_LAYER ? m_DirtyStaticCells : m_DirtyCells;
+}
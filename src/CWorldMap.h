@@ -0,0 +1,337 @@
+#pragma once
+
+#include "ELayer.h"
+#include "EDirection.h"
+#include "CWorldChunk.h"
+#include "CVisibilityIndex.h"
+#include "CDirtyCells.h"
+#include "CHurtObjectsRegistry.h"
+#include "CObject.h"
+#include "CPosition.h"
+#include "CRenderer.h"
+#include <map>
+#include <optional>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+/// @brief Occupancy grid of the whole game world.
+///        Every position holds a bitmask of layers that contain an object (see ELayer), a bitmask of layers
+///        whose object cannot be stepped on and one slot for an object for each layer.
+///        Thanks to the bitmasks, questions like "is this position walkable in these layers"
+///        are answered by a single load and mask test.
+///        Objects are stored in a slot map (see CSlotMap) and the cells hold generational handles to them
+///        (see CHandle). Other parts of the game can keep a handle instead of a pointer - once the object is erased
+///        from the world, its handle becomes stale and resolves to nullptr (see 'get_object()').
+///        Cells are grouped into chunks (see CWorldChunk) that are allocated on the first write and freed
+///        when they become empty. Chunks inside of the level (see 'set_dimensions()') are looked up in a directory
+///        ordered by their Z-order (Morton) code, so chunks close to each other are close in memory and
+///        iteration skips whole empty chunks. The level is split into square tiles as large as its shorter side
+///        (rounded up to a power of two), Z-order is used inside of the tiles and the tiles follow each other
+///        row by row, so long and narrow levels do not blow the directory up to a square of their longer side.
+///        Chunks outside of the level are stored in an ordered map.
+///        Bitboards of blocking cells kept by the chunks allow testing a whole row or column of a chunk
+///        with one word operation (see 'free_neighbours()' and 'first_blocker()').
+///        Region queries (see 'objects_in_radius()') skip unallocated chunks and chunks without objects
+///        of the layer and walk only the set bits of the occupied bitboards, so their cost follows
+///        the number of found objects rather than the area.
+///        The world also owns a visibility index (see CVisibilityIndex) that tells whether the player
+///        can be seen along a row or a column; it is recomputed only when the player moves or a wall changes.
+///        Every change of a cell (adding, erasing or moving an object) is recorded in a set of dirty cells
+///        (see CDirtyCells), so only the changed cells are pushed to the renderer each frame
+///        (see 'push_changes_to_render()'). Changes of the environment are recorded separately,
+///        since the environment is kept in the static layer of the renderer.
+class CWorldMap {
+public:
+    
+    /// Maximum number of released chunks kept for reuse, so bullets flying through empty areas
+    /// do not allocate and free chunks all the time.
+    static constexpr size_t MAX_SPARE_CHUNKS = 4;
+    
+    /// Default constructor of CWorldMap. The grid is empty until 'set_dimensions()' gets called.
+    CWorldMap();
+    
+    /// Allocates a cell for every position in the level and moves all already registered objects into it.
+    /// @param[in] width Width of the level (number of cells in one row of the grid).
+    /// @param[in] height Height of the level (number of rows of the grid).
+    void set_dimensions(int width, int height);
+    
+    /// @return Number of entries of the directory of chunks inside of the level (allocated or not).
+    [[nodiscard]] size_t directory_size() const;
+    
+    /// @param[in] position Position to check.
+    /// @return Bitmask of layers that have an object at %position.
+    [[nodiscard]] Layer::LayerMask occupied_layers_at(const CPosition& position) const;
+    
+    /// @param[in] position Position to check.
+    /// @return Bitmask of layers whose object at %position cannot be stepped on.
+    [[nodiscard]] Layer::LayerMask blocking_layers_at(const CPosition& position) const;
+    
+    /// Tests the cell at %position and its four neighbours at once.
+    /// @param[in] layers Bitmask of layers to test.
+    /// @param[in] position Position in the middle of the tested cells.
+    /// @return Bitmask indexed by Direction::EDirection - bit D is set when the cell 'position + D' can be stepped on
+    ///         in all %layers (bit Direction::NONE stands for %position itself).
+    [[nodiscard]] uint32_t free_neighbours(Layer::LayerMask layers, const CPosition& position) const;
+    
+    /// Finds the closest cell that cannot be stepped on along a row or a column.
+    /// The bitboards are scanned a whole chunk at a time and unallocated chunks are skipped.
+    /// @param[in] layers Bitmask of layers to test.
+    /// @param[in] from Position to start from (the position itself is not tested).
+    /// @param[in] direction Direction to look into.
+    /// @param[in] maxDistance Maximum distance from %from to look into.
+    /// @return Distance to the closest blocking cell or -1 if there is none within %maxDistance.
+    [[nodiscard]] int first_blocker(Layer::LayerMask layers, const CPosition& from, Direction::EDirection direction,
+                                    int maxDistance) const;
+    
+    /// Casts a ray along a row or a column and finds the first cell that cannot be stepped on.
+    /// @param[in] from Position to cast the ray from (the position itself is not tested).
+    /// @param[in] direction Direction of the ray.
+    /// @param[in] maxDistance Maximum length of the ray.
+    /// @param[in] layers Bitmask of layers whose blocking objects stop the ray.
+    /// @return Position where the ray got stopped or std::nullopt if it did not hit anything.
+    [[nodiscard]] std::optional<CPosition> raycast(const CPosition& from, Direction::EDirection direction,
+                                                   int maxDistance, Layer::LayerMask layers) const;
+    
+    /// @param[in] layers Bitmask of layers.
+    /// @return Number that changes whenever a blocking object is added to or erased from any of %layers.
+    [[nodiscard]] uint64_t blocking_version(Layer::LayerMask layers) const;
+    
+    /// Finds out whether %target can be seen from %position along a row or a column, walls (blocking objects
+    /// of the environment) cannot be seen through. Uses the visibility index, which gets recomputed
+    /// only if %target has moved or the walls have changed since the previous call.
+    /// @param[in] position Position to look from.
+    /// @param[in] target Position that should be seen.
+    /// @param[in] range Maximum distance at which %target can be seen.
+    /// @return Direction in which %target is seen or Direction::NONE if it cannot be seen.
+    Direction::EDirection direction_of_sight(const CPosition& position, const CPosition& target, int range);
+    
+    /// @param[in] layer Layer to look into.
+    /// @param[in] center Position to measure the distance from.
+    /// @param[in] radius Maximum Manhattan distance from %center.
+    /// @return All objects of %layer whose Manhattan distance from %center is at most %radius.
+    [[nodiscard]] std::vector<std::shared_ptr<CObject>> objects_in_radius(Layer::ELayer layer,
+                                                                        const CPosition& center, int radius) const;
+    
+    /// @param[in] layer Layer to look into.
+    /// @param[in] center Position to measure the distance from.
+    /// @param[in] count Maximum number of objects to return.
+    /// @return Up to %count objects of %layer closest to %center (by Manhattan distance), the closest one first.
+    [[nodiscard]] std::vector<std::shared_ptr<CObject>> nearest_objects(Layer::ELayer layer, const CPosition& center,
+                                                                      size_t count) const;
+    
+    /// @param[in] layer Layer to look into.
+    /// @param[in] position Position to look at.
+    /// @return Pointer to the object in %layer at %position (nullptr if there is none).
+    [[nodiscard]] std::shared_ptr<CObject> object_at(Layer::ELayer layer, const CPosition& position) const;
+    
+    /// @param[in] layer Layer to look into.
+    /// @param[in] position Position to look at.
+    /// @return Handle to the object in %layer at %position (null handle if there is none).
+    ///         The handle stays the same while the object moves.
+    [[nodiscard]] CHandle handle_at(Layer::ELayer layer, const CPosition& position) const;
+    
+    /// @param[in] handle Handle to an object of the world.
+    /// @return Pointer to the object or nullptr if the handle is stale (the object has been erased from the world).
+    [[nodiscard]] std::shared_ptr<CObject> get_object(CHandle handle) const;
+    
+    /// Registers new object into a layer using its position.
+    /// @param[in] layer Layer the object should be stored in.
+    /// @param[in] object Object to be added.
+    /// @return Handle to the object.
+    /// @warning If there is already an object in %layer at that position, it will get overwritten by the new object.
+    CHandle add_object(Layer::ELayer layer, const std::shared_ptr<CObject>& object);
+    
+    /// Erases object in a layer at position, if found.
+    /// @return Whether any object was erased or not.
+    bool erase_object_at(Layer::ELayer layer, const CPosition& position);
+    
+    /// Erases object from a layer by looking up its position and checking if the pointers match.
+    void erase_object(Layer::ELayer layer, const std::shared_ptr<CObject>& object);
+    
+    /// Checks if there is an object in a layer at some position and if the object's position
+    /// does not match with the position it is stored at, it will get remapped.
+    /// @throws std::out_of_range if there is no object in %layer at %position.
+    void update_position_of_object_at(Layer::ELayer layer, const CPosition& position);
+    
+    /// Tries dealing damage to objects in all %layers at some position.
+    /// Objects that get destroyed are erased from the world.
+    /// @param[in] layers Bitmask of layers that can be damaged.
+    /// @param[in] damagePoints Amount of damage points that should be dealt to each found object.
+    /// @param[in] position Position where there should be an attempt of dealing damage.
+    /// @param[in] exception Pointer to an object that we do not want to deal damage to.
+    /// @return Whether damage was dealt to at least one object.
+    bool try_dealing_damage_at(Layer::LayerMask layers, int damagePoints, const CPosition& position,
+                               const CObject* exception = nullptr);
+    
+    /// Puts all objects of a layer into renderer to be rendered later.
+    void push_objects_to_render(Layer::ELayer layer, CRenderer& renderer) const;
+    
+    /// Marks a cell whose looks have changed without the world knowing about it
+    /// (for example when an object stops being shown as hurt), so it gets rendered again.
+    /// @param[in] position Position of the cell.
+    void mark_dirty(const CPosition& position);
+    
+    /// Puts the cells that have changed since the last call into renderer and unmarks them.
+    /// Every such cell is cleared in the renderer first and then the objects at it are put into it -
+    /// the object of %STATIC_LAYER into the static layer of the renderer and the objects of the other layers
+    /// into the dynamic layer in the order of %DYNAMIC_RENDER_ORDER.
+    /// @param[in, out] renderer Renderer to put the cells into.
+    void push_changes_to_render(CRenderer& renderer);
+    
+    /// @return Registry of the objects of this world's game that are shown as hurt.
+    ///         Objects damaged through the world (see 'try_dealing_damage_at()') get registered in it.
+    [[nodiscard]] CHurtObjectsRegistry& get_hurt_objects();
+
+
+private:
+    
+    /// Finds the chunk that contains %position.
+    /// @return Pointer to the chunk or nullptr if it is not allocated.
+    [[nodiscard]] CWorldChunk* find_chunk(const CPosition& position) const;
+    
+    /// @return Chunk that contains %position. If it is not allocated, it gets allocated.
+    CWorldChunk& get_or_create_chunk(const CPosition& position);
+    
+    /// Frees the chunk that contains %position if there are no objects in it.
+    void release_chunk_if_empty(const CPosition& position);
+    
+    /// Puts a handle into a cell of a layer and marks the cell as occupied (and blocking).
+    /// The object that was in the cell before gets erased from the world.
+    /// @param[in] layer Layer of the object.
+    /// @param[in] position Position of the cell.
+    /// @param[in] handle Handle to the object.
+    /// @param[in] isBlocking Whether the object cannot be stepped on.
+    void place(Layer::ELayer layer, const CPosition& position, CHandle handle, bool isBlocking);
+    
+    /// Takes a handle out of a cell of a layer and marks the cell as empty. The object stays in the world.
+    /// @param[in] layer Layer of the object.
+    /// @param[in] position Position of the cell.
+    /// @return Handle that was in the cell (null handle if the cell was empty).
+    CHandle take(Layer::ELayer layer, const CPosition& position);
+    
+    /// Moves an empty chunk into %m_SpareChunks or frees it if there are enough spare chunks.
+    void recycle_chunk(std::unique_ptr<CWorldChunk>& chunk);
+    
+    /// @return Whether the chunk with coordinates [%chunkX, %chunkY] is stored in %m_Chunks.
+    [[nodiscard]] bool is_in_directory(int chunkX, int chunkY) const;
+    
+    /// Interleaves bits of the coordinates, so that chunks close to each other get close codes.
+    /// @return Z-order (Morton) code of the chunk with coordinates [%chunkX, %chunkY].
+    static uint64_t morton_code(uint32_t chunkX, uint32_t chunkY);
+    
+    /// @return Index of the chunk with coordinates [%chunkX, %chunkY] (inside of the level) in %m_Chunks -
+    ///         the index of its tile followed by the Z-order code of the chunk inside of the tile.
+    [[nodiscard]] size_t directory_index(int chunkX, int chunkY) const;
+    
+    /// Calls %function on every allocated chunk - first on the chunks in the directory
+    /// (in the order of the directory) and then on the chunks outside of the level.
+    template<typename F>
+    void for_each_chunk(F function) const;
+    
+    /// Appends objects of a layer inside of a region to %result. The region is given by its bounding box
+    /// and by %rowRange, which returns the first and the last column of the region in a row.
+    /// Only chunks overlapping the bounding box are visited.
+    template<typename F>
+    void collect_objects(Layer::ELayer layer, int minX, int minY, int maxX, int maxY, F rowRange,
+                         std::vector<std::shared_ptr<CObject>>& result) const;
+    
+    /// Objects that are shown as hurt. Declared before %m_Objects, so it outlives them.
+    CHurtObjectsRegistry m_HurtObjects;
+    
+    /// Objects of the world, the cells hold handles to them.
+    CSlotMap<std::shared_ptr<CObject>> m_Objects;
+    
+    /// Number of chunks in one row of the level.
+    int m_ChunksX;
+    
+    /// Number of chunks in one column of the level.
+    int m_ChunksY;
+    
+    /// Number of bits of a chunk coordinate that address a chunk inside of a tile of the directory.
+    int m_TileBits;
+    
+    /// Number of tiles of the directory in one row of the level.
+    int m_TilesX;
+    
+    /// Directory of chunks inside of the level indexed by 'directory_index()' (nullptr for unallocated chunks).
+    std::vector<std::unique_ptr<CWorldChunk>> m_Chunks;
+    
+    /// Allocated chunks outside of the level by their chunk coordinates.
+    std::map<std::pair<int, int>, std::unique_ptr<CWorldChunk>> m_OutsideChunks;
+    
+    /// Released empty chunks kept for reuse (see 'recycle_chunk()').
+    std::vector<std::unique_ptr<CWorldChunk>> m_SpareChunks;
+    
+    /// Number of objects stored in each layer. Used to skip empty layers when iterating.
+    size_t m_ObjectCounts[Layer::LAYER_COUNT];
+    
+    /// Number of changes of blocking objects in each layer (see 'blocking_version()').
+    uint64_t m_BlockingVersions[Layer::LAYER_COUNT];
+    
+    /// Index of cells from which the player can be seen (see 'direction_of_sight()').
+    CVisibilityIndex m_Visibility;
+    
+    /// Cells of the dynamic layers that have changed since they were last pushed to the renderer.
+    CDirtyCells m_DirtyCells;
+    
+    /// Cells of %STATIC_LAYER that have changed since they were last pushed to the renderer.
+    CDirtyCells m_DirtyStaticCells;
+    
+    /// Layer rendered into the static layer of the renderer. Its objects do not move.
+    static constexpr Layer::ELayer STATIC_LAYER = Layer::ENVIRONMENT;
+    
+    /// Order in which the other layers are put into the dynamic layer of the renderer,
+    /// objects of the later layers are drawn over objects of the earlier ones.
+    static constexpr Layer::ELayer DYNAMIC_RENDER_ORDER[] = {Layer::BULLET, Layer::ENTITY, Layer::BONUS};
+    
+    /// @param[in] layer Layer of an object.
+    /// @return Set of dirty cells that changes of objects in %layer are recorded in.
+    CDirtyCells& dirty_cells_of(Layer::ELayer layer);
+};
+
+template<typename F>
+void CWorldMap::for_each_chunk(F function) const {
+    for (const auto& chunk: m_Chunks) {
+        if (chunk) function(*chunk);
+    }
+    for (const auto& [coordinates, chunk]: m_OutsideChunks) {
+        function(*chunk);
+    }
+}
+
+template<typename F>
+void CWorldMap::collect_objects(Layer::ELayer layer, int minX, int minY, int maxX, int maxY, F rowRange,
+                                std::vector<std::shared_ptr<CObject>>& result) const {
+    if (m_ObjectCounts[layer] == 0 || minX > maxX || minY > maxY)
+        return;
+    
+    for (int chunkY = CWorldChunk::chunk_coordinate(minY); chunkY <= CWorldChunk::chunk_coordinate(maxY); ++chunkY) {
+        int chunkMinY = chunkY * CWorldChunk::SIZE;
+        int fromY = std::max(minY, chunkMinY);
+        int toY = std::min(maxY, chunkMinY + CWorldChunk::SIZE - 1);
+        
+        for (int chunkX = CWorldChunk::chunk_coordinate(minX); chunkX <= CWorldChunk::chunk_coordinate(maxX); ++chunkX) {
+            int chunkMinX = chunkX * CWorldChunk::SIZE;
+            const CWorldChunk* chunk = find_chunk(CPosition(chunkMinX, chunkMinY));
+            if (chunk == nullptr || chunk->m_LayerCounts[layer] == 0)
+                continue;
+            
+            for (int y = fromY; y <= toY; ++y) {
+                auto [rowMinX, rowMaxX] = rowRange(y);
+                int fromX = std::max(rowMinX, chunkMinX);
+                int toX = std::min(rowMaxX, chunkMinX + CWorldChunk::SIZE - 1);
+                if (fromX > toX)
+                    continue;
+                chunk->collect_row(layer, CWorldChunk::local_coordinate(y),
+                                   CWorldChunk::row_mask(CWorldChunk::local_coordinate(fromX),
+                                                         CWorldChunk::local_coordinate(toX)),
+                                   m_Objects, result);
+            }
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+/// @brief Enum for layers of the world that objects in the game can be stored in.
+///        Every position in CWorldMap can hold one object in each layer.
+namespace Layer {
+    enum ELayer {
+        ENVIRONMENT = 0,
+        ENTITY,
+        BULLET,
+        BONUS,
+        LAYER_COUNT
+    };
+    
+    /// Bitmask of layers - layer L is represented by the bit '1 << L'.
+    typedef uint8_t LayerMask;
+    
+    /// @param[in] layer Layer to convert.
+    /// @return Bitmask with only the bit of %layer set.
+    constexpr LayerMask mask_of(ELayer layer) {
+        return static_cast<LayerMask>(1u << layer);
+    }
+}
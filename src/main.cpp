@@ -1,27 +1,140 @@
 #include "CApplication.h"
 #include "CHighscoresManager.h"
+#include "CTerminalBackend.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+/// Maximum number of ticks of a simulation when --ticks is not given, so a bot that survives does not run forever.
+const size_t DEFAULT_SIMULATED_TICKS = 1000000;
+
+/// Prints how the program can be run.
+/// @param[in] program Name of the program.
+void print_usage(const std::string& program) {
+    std::cerr << "Usage: " << program << " [path_to_config] [--backend tty|null|counting]"
+              << " [--level path_to_level] [--ticks max_ticks] [--record path_to_recording] [--seed seed]" << std::endl
+              << "       " << program << " [path_to_config] [--backend tty|null|counting]"
+              << " --replay path_to_recording [--speed factor] [--from-frame index]" << std::endl
+              << "       " << program << " [path_to_config] --simulate path_to_level [--ticks max_ticks] [--seed seed]"
+              << " [--bot idle|random|hunter|script:path_to_script]" << std::endl
+              << " Without --level the menu is shown (it needs the tty backend)." << std::endl
+              << " With --level only that level is played and statistics are printed," << std::endl
+              << " --ticks ends it as a loss after the given number of ticks." << std::endl
+              << " --record records frames of the played levels, --replay replays them." << std::endl
+              << " --simulate lets a bot (hunter by default) play the level without a terminal as fast as possible" << std::endl
+              << " for at most --ticks ticks (" << DEFAULT_SIMULATED_TICKS << " by default)," << std::endl
+              << " --seed makes the game repeatable." << std::endl;
+}
+
+/// Prints an error. The message is colored only if the backend draws into a terminal,
+/// so headless runs (simulations, benchmarks) print plain text.
+/// @param[in] prefix Description of the error.
+/// @param[in] message Message of the error.
+/// @param[in] backend Backend the program runs with.
+void print_error(const std::string& prefix, const std::string& message, const CTerminalBackend& backend) {
+    std::cerr << prefix;
+    if (backend.is_interactive()) {
+        CTerminal::print_in_color(message, Color::RED, std::cerr);
+    } else {
+        std::cerr << message;
+    }
+    std::cerr << std::endl;
+}
+
+/// @param[in] value String to check.
+/// @return Whether %value is a non-negative integer.
+bool is_number(const std::string& value) {
+    return !value.empty() && value.size() < 10 && std::all_of(value.begin(), value.end(), ::isdigit);
+}
 
 int main(int argc, char** args) {
-    const std::string pathToConfig = (argc > 1 ? args[1] : "examples/default/default.cnfg");
-    std::srand(time(nullptr));
+    std::string pathToConfig = "examples/default/default.cnfg";
+    std::string backendName = "tty";
+    std::string pathToLevel;
+    size_t tickLimit = 0;
+    std::string pathToRecording;
+    std::string pathToReplay;
+    double speed = 1;
+    size_t firstFrame = 0;
+    std::string pathToSimulatedLevel;
+    std::string botPolicy = "hunter";
+    bool seeded = false;
+    unsigned int seed = 0;
+    
+    // Options have a value, anything else is the path to the config.
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = args[i];
+        if (argument.rfind("--", 0) != 0) {
+            pathToConfig = argument;
+            continue;
+        }
+        if (i + 1 == argc) {
+            print_usage(args[0]);
+            return EXIT_FAILURE;
+        }
+        const std::string value = args[++i];
+        if (argument == "--backend") {
+            backendName = value;
+        } else if (argument == "--level") {
+            pathToLevel = value;
+        } else if (argument == "--ticks" && is_number(value)) {
+            tickLimit = std::stoul(value);
+        } else if (argument == "--record") {
+            pathToRecording = value;
+        } else if (argument == "--replay") {
+            pathToReplay = value;
+        } else if (argument == "--speed" && std::strtod(value.c_str(), nullptr) > 0) {
+            speed = std::strtod(value.c_str(), nullptr);
+        } else if (argument == "--from-frame" && is_number(value)) {
+            firstFrame = std::stoul(value);
+        } else if (argument == "--simulate") {
+            pathToSimulatedLevel = value;
+        } else if (argument == "--bot") {
+            botPolicy = value;
+        } else if (argument == "--seed" && is_number(value)) {
+            seeded = true;
+            seed = std::stoul(value);
+        } else {
+            print_usage(args[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    
+    // A simulation does not use any terminal and always ends.
+    if (!pathToSimulatedLevel.empty()) {
+        backendName = "null";
+        if (tickLimit == 0)
+            tickLimit = DEFAULT_SIMULATED_TICKS;
+    }
+    std::shared_ptr<CTerminalBackend> backend = CTerminalBackend::create(backendName);
+    if (!backend) {
+        print_usage(args[0]);
+        return EXIT_FAILURE;
+    }
+    std::srand(seeded ? seed : time(nullptr));
     
     try {
         
-        CApplication app(pathToConfig);
-        app.run();
+        CApplication app(pathToConfig, backend);
+        app.set_recording(pathToRecording);
+        if (!pathToSimulatedLevel.empty()) {
+            app.simulate_level(pathToSimulatedLevel, tickLimit, botPolicy);
+        } else if (!pathToReplay.empty()) {
+            app.replay(pathToReplay, speed, firstFrame);
+        } else if (pathToLevel.empty()) {
+            app.run();
+        } else {
+            app.run_level(pathToLevel, tickLimit);
+        }
         
     } catch (std::invalid_argument& e) {
-        std::cerr << "Error reading config file: ";
-        CTerminal::print_in_color(e.what(), Color::RED, std::cerr);
-        std::cerr << std::endl;
+        print_error("Error reading config file: ", e.what(), *backend);
         
         return EXIT_FAILURE;
         
     } catch (std::exception& e) {
-        CTerminal::reset_terminal();
-        std::cerr << "Unexpected error occurred: ";
-        CTerminal::print_in_color(e.what(), Color::RED, std::cerr);
-        std::cerr << std::endl;
+        backend->reset();
+        print_error("Unexpected error occurred: ", e.what(), *backend);
         CTerminal::non_blocking_input_off();
         
         return EXIT_FAILURE;
@@ -31,4 +144,4 @@ int main(int argc, char** args) {
     return EXIT_SUCCESS;
     
     
-}
\ No newline at end of file
+}
@@ -0,0 +1,126 @@
+#include "CWorldMap.h"
+#include "CSlotMap.h"
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+    /// Object that can be moved around by the test.
+    class CTestObject : public CObject {
+    public:
+        explicit CTestObject(const CPosition& position)
+                : CObject(position, 1, CVisualBlock(), false) {}
+        
+        void move_to(const CPosition& position) {
+            m_Position = position;
+        }
+    };
+    
+    std::shared_ptr<CTestObject> make_object(const CPosition& position) {
+        return std::make_shared<CTestObject>(position);
+    }
+    
+    /// An erased value leaves a stale handle behind, even when its slot gets reused.
+    void test_stale_slot_map_handle() {
+        CSlotMap<int> values;
+        CHandle first = values.emplace(1);
+        assert(values.get(first) != nullptr && *values.get(first) == 1);
+        
+        assert(values.erase(first));
+        assert(values.get(first) == nullptr);
+        assert(!values.erase(first));
+        
+        CHandle second = values.emplace(2);
+        assert(second.index() == first.index());
+        assert(second != first);
+        assert(values.get(first) == nullptr);
+        assert(*values.get(second) == 2);
+        
+        values.clear();
+        assert(values.get(second) == nullptr);
+        assert(values.get(CHandle()) == nullptr);
+    }
+    
+    /// A handle follows its object while it moves and becomes stale once the object is erased.
+    void test_stale_world_handle() {
+        CWorldMap world;
+        world.set_dimensions(64, 64);
+        std::shared_ptr<CTestObject> object = make_object(CPosition(10, 10));
+        CHandle handle = world.add_object(Layer::ENTITY, object);
+        assert(world.handle_at(Layer::ENTITY, CPosition(10, 10)) == handle);
+        assert(world.get_object(handle) == object);
+        
+        // Move the object into another chunk.
+        object->move_to(CPosition(40, 10));
+        world.update_position_of_object_at(Layer::ENTITY, CPosition(10, 10));
+        assert(world.handle_at(Layer::ENTITY, CPosition(40, 10)) == handle);
+        assert(world.handle_at(Layer::ENTITY, CPosition(10, 10)).is_null());
+        assert(world.get_object(handle) == object);
+        
+        assert(world.erase_object_at(Layer::ENTITY, CPosition(40, 10)));
+        assert(world.get_object(handle) == nullptr);
+        
+        // The slot of the erased object is reused, but the old handle must not resolve to the new object.
+        CHandle other = world.add_object(Layer::ENTITY, make_object(CPosition(40, 10)));
+        assert(other.index() == handle.index());
+        assert(world.get_object(handle) == nullptr);
+        assert(world.get_object(other) != nullptr);
+        
+        // An overwritten object is erased from the world as well.
+        world.add_object(Layer::ENTITY, make_object(CPosition(40, 10)));
+        assert(world.get_object(other) == nullptr);
+    }
+    
+    /// The directory of a long and narrow level stays close to the number of its chunks in both orientations.
+    void test_long_narrow_level() {
+        const int LENGTH = 4096 * CWorldChunk::SIZE;
+        const int WIDTH = 3 * CWorldChunk::SIZE;
+        
+        for (bool isTall: {true, false}) {
+            CWorldMap world;
+            world.set_dimensions(isTall ? WIDTH : LENGTH, isTall ? LENGTH : WIDTH);
+            // 3 x 4096 chunks are padded to tiles of 4 x 4 chunks.
+            assert(world.directory_size() == 4 * 4096);
+            
+            // Objects at both ends and in the middle are found again.
+            std::vector<CPosition> positions = {CPosition(0, 0), CPosition(WIDTH - 1, LENGTH - 1),
+                                                CPosition(WIDTH / 2, LENGTH / 2)};
+            for (CPosition& position: positions) {
+                if (!isTall) std::swap(position.m_X, position.m_Y);
+                world.add_object(Layer::ENVIRONMENT, make_object(position));
+            }
+            for (const CPosition& position: positions) {
+                assert(world.object_at(Layer::ENVIRONMENT, position) != nullptr);
+                assert(world.object_at(Layer::ENVIRONMENT, position)->get_position() == position);
+            }
+            assert(world.nearest_objects(Layer::ENVIRONMENT, positions[1], 10).size() == positions.size());
+            assert(world.nearest_objects(Layer::ENVIRONMENT, positions[1], 1)[0]->get_position() == positions[1]);
+        }
+    }
+    
+    /// Objects damaged through the world are registered in its registry and forget it when the world is gone.
+    void test_hurt_objects_outlive_world() {
+        std::shared_ptr<CTestObject> object = make_object(CPosition(3, 3));
+        {
+            CWorldMap world;
+            world.set_dimensions(16, 16);
+            world.add_object(Layer::ENTITY, object);
+            assert(world.try_dealing_damage_at(Layer::mask_of(Layer::ENTITY), 0, CPosition(3, 3), nullptr));
+            assert(world.get_hurt_objects().size() == 1);
+            assert(object->get_sprite_id() != CSpritePalette::intern(CVisualBlock()));
+        }
+        // The registry is gone, so the object is not shown as hurt and can be destroyed safely.
+        assert(object->get_sprite_id() == CSpritePalette::intern(CVisualBlock()));
+    }
+}
+
+int main() {
+    test_stale_slot_map_handle();
+    test_stale_world_handle();
+    test_hurt_objects_outlive_world();
+    test_long_narrow_level();
+    std::cout << "CWorldMapTest: OK" << std::endl;
+    return 0;
+}